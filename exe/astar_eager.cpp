@@ -41,9 +41,29 @@ int main(int argc, char** argv)
         .default_value(false)
         .implicit_value(true)
         .help("Disable invariant synthesis during ground task instantiation.");
+    program.add_argument("--max-invariant-synthesis-time")
+        .scan<'u', size_t>()
+        .help("The time limit of invariant synthesis in milliseconds. Defaults to no limit.");
+    program.add_argument("--enable-relevance-analysis")
+        .default_value(false)
+        .implicit_value(true)
+        .help("Prune ground actions, axioms, and FDR variables that are irrelevant for reaching the goal.");
+    program.add_argument("--action-matcher")
+        .default_value("automatic")
+        .choices("match_tree", "bitset", "automatic")
+        .help("The data structure that generates applicable ground actions.");
     program.add_argument("-H", "--heuristic-type")
         .default_value("blind")
         .choices("blind", "goal_count", "rpg_max", "rpg_add", "rpg_ff", "canonical", "projection_abstraction_first");
+    program.add_argument("--state-storage")
+        .default_value("automatic")
+        .choices("hash_set", "tree_compression", "automatic")
+        .help("The state storage backend. Requires TYR_STATE_STORAGE_POLICY=Dynamic.");
+    program.add_argument("--state-storage-migration-threshold")
+        .default_value(size_t(1) << 30)
+        .scan<'u', size_t>()
+        .help("The number of bytes after which automatic state storage migrates from hash set to tree compression.");
+    program.add_argument("--max-memory").scan<'u', size_t>().help("The memory limit of the search in bytes. Defaults to no limit.");
     program.add_argument("-V", "--verbosity")
         .default_value(size_t(0))
         .scan<'u', size_t>()
@@ -72,12 +92,34 @@ int main(int argc, char** argv)
         auto shuffle_labeled_succ_nodes = program.get<bool>("--shuffle-labeled-succ-nodes");
         auto instantiate_ground_task = program.get<bool>("--instantiate-ground-task");
         auto disable_invariant_synthesis = program.get<bool>("--disable-invariant-synthesis");
+        auto max_invariant_synthesis_time = program.present<size_t>("--max-invariant-synthesis-time");
+        auto enable_relevance_analysis = program.get<bool>("--enable-relevance-analysis");
+        const auto action_matcher_name = program.get<std::string>("--action-matcher");
+        auto action_matcher = planning::ActionMatcherKind::AUTOMATIC;
+        if (action_matcher_name == "match_tree")
+            action_matcher = planning::ActionMatcherKind::MATCH_TREE;
+        else if (action_matcher_name == "bitset")
+            action_matcher = planning::ActionMatcherKind::BITSET;
         auto heuristic_type = program.get<std::string>("--heuristic-type");
         auto verbosity = program.get<size_t>("--verbosity");
 
+        auto storage_options = planning::StateStorageOptions();
+        const auto state_storage = program.get<std::string>("--state-storage");
+        if (state_storage == "hash_set")
+            storage_options.kind = planning::StateStorageKind::HASH_SET;
+        else if (state_storage == "tree_compression")
+            storage_options.kind = planning::StateStorageKind::TREE_COMPRESSION;
+        else
+            storage_options.kind = planning::StateStorageKind::AUTOMATIC;
+        storage_options.migration_threshold = program.get<size_t>("--state-storage-migration-threshold");
+        auto max_memory = program.present<size_t>("--max-memory");
+
         std::cout << "[INPUT] Num worker threads: " << num_worker_threads << std::endl;
         std::cout << "[INPUT] Random seed: " << random_seed << std::endl;
         std::cout << "[INPUT] Shuffle labeled successor nodes: " << shuffle_labeled_succ_nodes << std::endl;
+        std::cout << "[INPUT] State storage: " << state_storage << std::endl;
+        if (max_memory)
+            std::cout << "[INPUT] Max memory: " << max_memory.value() << " bytes" << std::endl;
 
         auto parser_options = loki::ParserOptions();
         // parser_options.strict = true;
@@ -96,13 +138,14 @@ int main(int argc, char** argv)
 
         if (!instantiate_ground_task)
         {
-            auto successor_generator = planning::SuccessorGenerator<planning::LiftedTag>(lifted_task, execution_context);
+            auto successor_generator = planning::SuccessorGenerator<planning::LiftedTag>(lifted_task, execution_context, storage_options);
 
             auto options = planning::astar_eager::Options<planning::LiftedTag>();
             options.start_node = successor_generator.get_initial_node();
             options.event_handler = planning::astar_eager::DefaultEventHandler<planning::LiftedTag>::create(verbosity);
             options.random_seed = random_seed;
             options.shuffle_labeled_succ_nodes = shuffle_labeled_succ_nodes;
+            options.max_memory = max_memory;
 
             auto heuristic = std::shared_ptr<planning::Heuristic<planning::LiftedTag>> { nullptr };
             if (heuristic_type == "blind")
@@ -181,6 +224,9 @@ int main(int argc, char** argv)
 
             auto result = planning::astar_eager::find_solution(*lifted_task, successor_generator, *heuristic, options);
 
+            if (result.status == planning::SearchStatus::OUT_OF_MEMORY)
+                std::cout << "[Search] Memory limit reached!" << std::endl;
+
             if (result.status == planning::SearchStatus::SOLVED)
             {
                 std::ofstream plan_file;
@@ -206,6 +252,10 @@ int main(int argc, char** argv)
         {
             auto ground_task_instantiation_options = planning::GroundTaskInstantiationOptions();
             ground_task_instantiation_options.disable_invariant_synthesis = disable_invariant_synthesis;
+            if (max_invariant_synthesis_time)
+                ground_task_instantiation_options.max_invariant_synthesis_time = std::chrono::milliseconds(max_invariant_synthesis_time.value());
+            ground_task_instantiation_options.enable_relevance_analysis = enable_relevance_analysis;
+            ground_task_instantiation_options.action_matcher = action_matcher;
             auto ground_task_instantiation_result = lifted_task->instantiate_ground_task(*execution_context, ground_task_instantiation_options);
 
             if (ground_task_instantiation_result.status == planning::GroundTaskInstantiationStatus::PROVEN_UNSOLVABLE)
@@ -216,13 +266,14 @@ int main(int argc, char** argv)
             {
                 auto ground_task = ground_task_instantiation_result.task;
 
-                auto successor_generator = planning::SuccessorGenerator<planning::GroundTag>(ground_task, execution_context);
+                auto successor_generator = planning::SuccessorGenerator<planning::GroundTag>(ground_task, execution_context, storage_options);
 
                 auto options = planning::astar_eager::Options<planning::GroundTag>();
                 options.start_node = successor_generator.get_initial_node();
                 options.event_handler = planning::astar_eager::DefaultEventHandler<planning::GroundTag>::create(verbosity);
                 options.random_seed = random_seed;
                 options.shuffle_labeled_succ_nodes = shuffle_labeled_succ_nodes;
+                options.max_memory = max_memory;
 
                 auto heuristic = std::shared_ptr<planning::Heuristic<planning::GroundTag>> { nullptr };
                 if (heuristic_type == "blind")
@@ -234,6 +285,9 @@ int main(int argc, char** argv)
 
                 auto result = planning::astar_eager::find_solution(*ground_task, successor_generator, *heuristic, options);
 
+                if (result.status == planning::SearchStatus::OUT_OF_MEMORY)
+                    std::cout << "[Search] Memory limit reached!" << std::endl;
+
                 if (result.status == planning::SearchStatus::SOLVED)
                 {
                     std::ofstream plan_file;
@@ -18,9 +18,13 @@
 #ifndef TYR_COMMON_MEMORY_HPP_
 #define TYR_COMMON_MEMORY_HPP_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <string>
 
 #if defined(__linux__) || defined(__APPLE__)
 #include <sys/resource.h>
@@ -68,6 +72,73 @@ inline int64_t get_peak_memory_usage_in_bytes()
     return memory_in_kb * 1024;
 }
 
+/// @brief Returns the resident set size of the process in bytes, or -1 on error.
+inline int64_t get_current_memory_usage_in_bytes()
+{
+    int64_t memory_in_kb = -1;
+
+#if defined(__APPLE__)
+    mach_task_basic_info t_info;
+    mach_msg_type_number_t t_info_count = MACH_TASK_BASIC_INFO_COUNT;
+
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&t_info), &t_info_count) == KERN_SUCCESS)
+    {
+        memory_in_kb = t_info.resident_size / 1024;
+    }
+#else
+    std::ifstream procfile("/proc/self/status");
+    std::string word;
+    while (procfile >> word)
+    {
+        if (word == "VmRSS:")
+        {
+            procfile >> memory_in_kb;
+            break;
+        }
+        // Skip to end of line.
+        procfile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    if (procfile.fail())
+        memory_in_kb = -1;
+#endif
+
+    return (memory_in_kb == -1) ? -1 : memory_in_kb * 1024;
+}
+
+/// @brief `MemoryBudget` enforces a hard byte limit.
+///
+/// The bytes reported by data structures with explicit accounting are checked on every call.
+/// Allocations without accounting, e.g., in grounder caches or Datalog workspaces,
+/// are covered by sampling the resident set size every `sample_interval` calls.
+class MemoryBudget
+{
+private:
+    size_t m_max_bytes;
+    size_t m_sample_interval;
+    size_t m_num_checks;
+    size_t m_sampled_bytes;
+
+public:
+    explicit MemoryBudget(size_t max_bytes, size_t sample_interval = 1024) :
+        m_max_bytes(max_bytes),
+        m_sample_interval(std::max(sample_interval, size_t(1))),
+        m_num_checks(0),
+        m_sampled_bytes(0)
+    {
+    }
+
+    bool is_exceeded(size_t accounted_bytes)
+    {
+        if (m_num_checks++ % m_sample_interval == 0)
+            m_sampled_bytes = static_cast<size_t>(std::max(get_current_memory_usage_in_bytes(), int64_t(0)));
+
+        return std::max(accounted_bytes, m_sampled_bytes) >= m_max_bytes;
+    }
+
+    size_t get_max_bytes() const { return m_max_bytes; }
+    size_t get_sampled_bytes() const { return m_sampled_bytes; }
+};
+
 }
 
 #endif
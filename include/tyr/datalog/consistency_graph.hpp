@@ -25,6 +25,7 @@
 #include "tyr/datalog/delta_kpkc_graph.hpp"
 #include "tyr/formalism/datalog/repository.hpp"
 #include "tyr/formalism/datalog/views.hpp"
+#include "tyr/formalism/numeric_bytecode.hpp"
 
 #include <boost/dynamic_bitset/dynamic_bitset.hpp>
 #include <optional>
@@ -126,6 +127,9 @@ struct RuleToConstraintInfo
 
     size_t kpkc_arity;
 
+    formalism::NumericBytecode bytecode;  ///< function terms are loaded by their index into the infos above.
+    formalism::NumericConstraintCode code;
+
     template<formalism::FactKind T>
     const auto& get() const noexcept
     {
@@ -0,0 +1,354 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_FORMALISM_NUMERIC_BYTECODE_HPP_
+#define TYR_FORMALISM_NUMERIC_BYTECODE_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/common/declarations.hpp"
+#include "tyr/common/variant.hpp"
+#include "tyr/formalism/arithmetic_operator_utils.hpp"
+#include "tyr/formalism/boolean_operator_utils.hpp"
+#include "tyr/formalism/declarations.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace tyr::formalism
+{
+
+enum class NumericOpCode : uint8_t
+{
+    CONSTANT,        ///< push the constant with index arg
+    LOAD_STATIC,     ///< push the value of the static function term with index arg
+    LOAD_FLUENT,     ///< push the value of the fluent function term with index arg
+    LOAD_AUXILIARY,  ///< push the auxiliary value
+    NEG,
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+};
+
+enum class NumericComparator : uint8_t
+{
+    EQ,
+    NE,
+    LE,
+    LT,
+    GE,
+    GT,
+};
+
+struct NumericInstruction
+{
+    NumericOpCode opcode;
+    uint_t arg;
+};
+
+/// @brief A compiled expression is a range of postfix instructions in a NumericBytecode.
+struct NumericExpressionCode
+{
+    uint_t begin = 0;
+    uint_t end = 0;
+    uint_t max_stack_size = 0;
+};
+
+struct NumericConstraintCode
+{
+    NumericComparator comparator = NumericComparator::EQ;
+    NumericExpressionCode lhs;
+    NumericExpressionCode rhs;
+};
+
+/// @brief Contiguous storage of compiled numeric expressions.
+///
+/// Expressions are emitted in postfix order between begin_expression and end_expression.
+/// Function terms are resolved to load instructions by the caller, such that the same bytecode
+/// can be interpreted over scalars for ground states and over intervals for the Datalog consistency graph.
+class NumericBytecode
+{
+public:
+    NumericBytecode() = default;
+
+    void begin_expression() noexcept
+    {
+        m_begin = m_code.size();
+        m_depth = 0;
+        m_max_depth = 0;
+    }
+
+    void emit_constant(float_t value)
+    {
+        m_code.push_back(NumericInstruction { NumericOpCode::CONSTANT, uint_t(m_constants.size()) });
+        m_constants.push_back(value);
+        push();
+    }
+
+    void emit_load(NumericOpCode opcode, uint_t arg = 0)
+    {
+        assert(opcode == NumericOpCode::LOAD_STATIC || opcode == NumericOpCode::LOAD_FLUENT || opcode == NumericOpCode::LOAD_AUXILIARY);
+        m_code.push_back(NumericInstruction { opcode, arg });
+        push();
+    }
+
+    void emit_operator(NumericOpCode opcode)
+    {
+        assert(opcode >= NumericOpCode::NEG);
+        m_code.push_back(NumericInstruction { opcode, 0 });
+        if (opcode != NumericOpCode::NEG)
+            --m_depth;
+    }
+
+    NumericExpressionCode end_expression() noexcept
+    {
+        assert(m_depth == 1);
+        return NumericExpressionCode { uint_t(m_begin), uint_t(m_code.size()), uint_t(m_max_depth) };
+    }
+
+    const auto& get_code() const noexcept { return m_code; }
+    const auto& get_constants() const noexcept { return m_constants; }
+
+    size_t memory_usage() const noexcept { return m_code.capacity() * sizeof(NumericInstruction) + m_constants.capacity() * sizeof(float_t); }
+
+private:
+    void push() noexcept { m_max_depth = std::max(m_max_depth, ++m_depth); }
+
+    std::vector<NumericInstruction> m_code;
+    std::vector<float_t> m_constants;
+
+    size_t m_begin = 0;
+    size_t m_depth = 0;
+    size_t m_max_depth = 0;
+};
+
+/**
+ * Compilation
+ */
+
+template<ArithmeticOpKind O>
+constexpr NumericOpCode get_opcode() noexcept
+{
+    if constexpr (std::is_same_v<O, OpAdd>)
+        return NumericOpCode::ADD;
+    else if constexpr (std::is_same_v<O, OpSub>)
+        return NumericOpCode::SUB;
+    else if constexpr (std::is_same_v<O, OpMul>)
+        return NumericOpCode::MUL;
+    else
+        return NumericOpCode::DIV;
+}
+
+template<BooleanOpKind O>
+constexpr NumericComparator get_comparator() noexcept
+{
+    if constexpr (std::is_same_v<O, OpEq>)
+        return NumericComparator::EQ;
+    else if constexpr (std::is_same_v<O, OpNe>)
+        return NumericComparator::NE;
+    else if constexpr (std::is_same_v<O, OpLe>)
+        return NumericComparator::LE;
+    else if constexpr (std::is_same_v<O, OpLt>)
+        return NumericComparator::LT;
+    else if constexpr (std::is_same_v<O, OpGe>)
+        return NumericComparator::GE;
+    else
+        return NumericComparator::GT;
+}
+
+/// @brief Emit the postfix code of a function expression view of any formalism.
+/// @param emit_load is called with the bytecode and each function term view and must emit exactly one load instruction.
+template<typename Expression, typename EmitLoad>
+void emit_expression(Expression element, NumericBytecode& bytecode, EmitLoad&& emit_load)
+{
+    if constexpr (std::is_same_v<Expression, float_t>)
+    {
+        bytecode.emit_constant(element);
+    }
+    else if constexpr (requires { element.get_variant(); })
+    {
+        visit([&](auto&& arg) { emit_expression(arg, bytecode, emit_load); }, element.get_variant());
+    }
+    else if constexpr (requires { typename Expression::OpType; element.get_arg(); })
+    {
+        static_assert(std::is_same_v<typename Expression::OpType, OpSub>, "Unexpected unary operator.");
+        emit_expression(element.get_arg(), bytecode, emit_load);
+        bytecode.emit_operator(NumericOpCode::NEG);
+    }
+    else if constexpr (requires { typename Expression::OpType; element.get_lhs(); })
+    {
+        emit_expression(element.get_lhs(), bytecode, emit_load);
+        emit_expression(element.get_rhs(), bytecode, emit_load);
+        bytecode.emit_operator(get_opcode<typename Expression::OpType>());
+    }
+    else if constexpr (requires { typename Expression::OpType; element.get_args(); })
+    {
+        const auto args = element.get_args();
+        assert(!args.empty());
+
+        emit_expression(args.front(), bytecode, emit_load);
+        for (auto it = std::next(args.begin()); it != args.end(); ++it)
+        {
+            emit_expression(*it, bytecode, emit_load);
+            bytecode.emit_operator(get_opcode<typename Expression::OpType>());
+        }
+    }
+    else
+    {
+        emit_load(bytecode, element);
+    }
+}
+
+template<typename Expression, typename EmitLoad>
+NumericExpressionCode compile_expression(Expression element, NumericBytecode& bytecode, EmitLoad&& emit_load)
+{
+    bytecode.begin_expression();
+    emit_expression(element, bytecode, emit_load);
+    return bytecode.end_expression();
+}
+
+/// @brief Compile a boolean operator view of any formalism into two expressions and a comparator.
+template<typename Constraint, typename EmitLoad>
+NumericConstraintCode compile_constraint(Constraint element, NumericBytecode& bytecode, EmitLoad&& emit_load)
+{
+    return visit(
+        [&](auto&& arg)
+        {
+            using Alternative = std::decay_t<decltype(arg)>;
+
+            auto result = NumericConstraintCode {};
+            result.comparator = get_comparator<typename Alternative::OpType>();
+            result.lhs = compile_expression(arg.get_lhs(), bytecode, emit_load);
+            result.rhs = compile_expression(arg.get_rhs(), bytecode, emit_load);
+            return result;
+        },
+        element.get_variant());
+}
+
+/**
+ * Interpretation
+ */
+
+/// @brief Evaluate a compiled expression over scalars or intervals.
+/// @param load is called with each load instruction and returns its value.
+template<typename T, typename Load>
+T evaluate(const NumericBytecode& bytecode, const NumericExpressionCode& expression, Load&& load)
+{
+    static constexpr size_t max_inline_stack_size = 32;
+
+    const auto run = [&](T* stack) -> T
+    {
+        const auto* code = bytecode.get_code().data();
+        auto top = size_t(0);  ///< number of values on the stack
+
+        for (auto i = expression.begin; i < expression.end; ++i)
+        {
+            const auto& instruction = code[i];
+
+            switch (instruction.opcode)
+            {
+                case NumericOpCode::CONSTANT:
+                {
+                    const auto value = bytecode.get_constants()[instruction.arg];
+                    if constexpr (std::is_floating_point_v<T>)
+                        stack[top++] = value;
+                    else
+                        stack[top++] = T(value, value);
+                    break;
+                }
+                case NumericOpCode::LOAD_STATIC:
+                case NumericOpCode::LOAD_FLUENT:
+                case NumericOpCode::LOAD_AUXILIARY:
+                    stack[top++] = load(instruction);
+                    break;
+                case NumericOpCode::NEG:
+                    stack[top - 1] = apply(OpSub {}, stack[top - 1]);
+                    break;
+                case NumericOpCode::ADD:
+                    --top;
+                    stack[top - 1] = apply(OpAdd {}, stack[top - 1], stack[top]);
+                    break;
+                case NumericOpCode::SUB:
+                    --top;
+                    stack[top - 1] = apply(OpSub {}, stack[top - 1], stack[top]);
+                    break;
+                case NumericOpCode::MUL:
+                    --top;
+                    stack[top - 1] = apply(OpMul {}, stack[top - 1], stack[top]);
+                    break;
+                case NumericOpCode::DIV:
+                    --top;
+                    stack[top - 1] = apply(OpDiv {}, stack[top - 1], stack[top]);
+                    break;
+            }
+        }
+
+        assert(top == 1);
+        return stack[0];
+    };
+
+    if (expression.max_stack_size <= max_inline_stack_size)
+    {
+        auto stack = std::array<T, max_inline_stack_size> {};
+        return run(stack.data());
+    }
+
+    auto stack = std::vector<T>(expression.max_stack_size);
+    return run(stack.data());
+}
+
+/// @brief Evaluate a compiled constraint.
+/// @param compare is called with the operator tag and the values of both sides, e.g., apply or apply_existential.
+template<typename T, typename Load, typename Compare>
+bool evaluate(const NumericBytecode& bytecode, const NumericConstraintCode& constraint, Load&& load, Compare&& compare)
+{
+    const auto lhs = evaluate<T>(bytecode, constraint.lhs, load);
+    const auto rhs = evaluate<T>(bytecode, constraint.rhs, load);
+
+    switch (constraint.comparator)
+    {
+        case NumericComparator::EQ:
+            return compare(OpEq {}, lhs, rhs);
+        case NumericComparator::NE:
+            return compare(OpNe {}, lhs, rhs);
+        case NumericComparator::LE:
+            return compare(OpLe {}, lhs, rhs);
+        case NumericComparator::LT:
+            return compare(OpLt {}, lhs, rhs);
+        case NumericComparator::GE:
+            return compare(OpGe {}, lhs, rhs);
+        case NumericComparator::GT:
+            return compare(OpGt {}, lhs, rhs);
+    }
+
+    return false;
+}
+
+template<typename Load>
+bool evaluate(const NumericBytecode& bytecode, const NumericConstraintCode& constraint, Load&& load)
+{
+    return evaluate<float_t>(bytecode, constraint, load, [](auto op, float_t lhs, float_t rhs) { return apply(op, lhs, rhs); });
+}
+
+}
+
+#endif
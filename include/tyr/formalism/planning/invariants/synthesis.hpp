@@ -19,12 +19,27 @@
 #define TYR_FORMALISM_PLANNING_INVARIANTS_SYNTHESIS_HPP_
 
 #include "tyr/common/declarations.hpp"
+#include "tyr/common/onetbb.hpp"
 #include "tyr/formalism/planning/invariants/invariant.hpp"
 #include "tyr/formalism/planning/repository.hpp"
 
+#include <chrono>
+#include <optional>
+
 namespace tyr::formalism::planning::invariant
 {
+struct SynthesisOptions
+{
+    /// @brief Return the invariants proven so far once the time limit is reached.
+    std::optional<std::chrono::steady_clock::duration> max_time = std::nullopt;
+};
+
 InvariantList synthesize_invariants(DomainView domain);
+
+/// @brief Prove the candidates of each refinement round in parallel.
+///
+/// The result does not depend on the number of threads unless the time limit is reached.
+InvariantList synthesize_invariants(DomainView domain, ExecutionContext& execution_context, const SynthesisOptions& options = SynthesisOptions());
 }
 
 #endif
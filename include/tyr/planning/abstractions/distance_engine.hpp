@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_ABSTRACTIONS_DISTANCE_ENGINE_HPP_
+#define TYR_PLANNING_ABSTRACTIONS_DISTANCE_ENGINE_HPP_
+
+#include "tyr/common/config.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace tyr::planning
+{
+
+/**
+ * Goal distances in abstractions.
+ *
+ * The graph is the reversed transition system in compressed sparse row format: the entries e of a vertex v are
+ * [g.offsets()[v], g.offsets()[v + 1]), where g.sources()[e] is the source of the forward transition g.transitions()[e] into v.
+ * The weights are indexed by forward transition and must be nonnegative.
+ */
+
+enum class DistanceAlgorithm
+{
+    BFS,         ///< all weights are equal
+    DIAL,        ///< all weights are small integers
+    RADIX_HEAP,  ///< general weights
+};
+
+/// @brief The largest weight for which integral weights are handled by Dial's algorithm, i.e., the number of buckets minus one.
+inline constexpr uint_t max_dial_weight = 1024;
+
+inline DistanceAlgorithm select_distance_algorithm(std::span<const float_t> weights) noexcept
+{
+    if (weights.empty() || std::all_of(weights.begin(), weights.end(), [&](const auto w) { return w == weights.front(); }))
+        return DistanceAlgorithm::BFS;
+
+    if (std::all_of(weights.begin(), weights.end(), [](const auto w) { return w <= max_dial_weight && w == std::floor(w); }))
+        return DistanceAlgorithm::DIAL;
+
+    return DistanceAlgorithm::RADIX_HEAP;
+}
+
+/// @brief Breadth-first search from the goal vertices, where every transition has the given weight.
+template<typename Graph>
+std::vector<float_t> compute_goal_distances_bfs(const Graph& g, float_t weight)
+{
+    auto levels = std::vector<uint_t>(g.num_vertices(), std::numeric_limits<uint_t>::max());
+    auto queue = std::vector<uint_t> {};
+    queue.reserve(g.num_vertices());
+
+    for (const auto v : g.goal_vertices())
+    {
+        if (levels[v] == std::numeric_limits<uint_t>::max())
+        {
+            levels[v] = 0;
+            queue.push_back(v);
+        }
+    }
+
+    const auto& offsets = g.offsets();
+    const auto& sources = g.sources();
+
+    // The queue is a vector that is never popped, such that the vertices are visited in the order of their insertion.
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        const auto v = queue[head];
+        for (auto e = offsets[v]; e < offsets[v + 1]; ++e)
+        {
+            const auto u = sources[e];
+            if (levels[u] == std::numeric_limits<uint_t>::max())
+            {
+                levels[u] = levels[v] + 1;
+                queue.push_back(u);
+            }
+        }
+    }
+
+    auto distances = std::vector<float_t>(g.num_vertices(), std::numeric_limits<float_t>::infinity());
+    for (const auto v : queue)
+        distances[v] = levels[v] * weight;
+
+    return distances;
+}
+
+/// @brief Dial's algorithm with a cyclic array of max_weight + 1 buckets for integral weights in [0, max_weight].
+template<typename Graph>
+std::vector<float_t> compute_goal_distances_dial(const Graph& g, std::span<const float_t> weights, uint_t max_weight)
+{
+    constexpr auto unreached = std::numeric_limits<uint_t>::max();
+
+    auto distances = std::vector<uint_t>(g.num_vertices(), unreached);
+    auto buckets = std::vector<std::vector<uint_t>>(max_weight + 1);
+    auto num_queued = size_t(0);
+
+    for (const auto v : g.goal_vertices())
+    {
+        if (distances[v] == unreached)
+        {
+            distances[v] = 0;
+            buckets[0].push_back(v);
+            ++num_queued;
+        }
+    }
+
+    const auto& offsets = g.offsets();
+    const auto& sources = g.sources();
+    const auto& transitions = g.transitions();
+
+    // All queued distances lie in [d, d + max_weight], such that each bucket holds the entries of a single distance.
+    for (uint_t d = 0; num_queued > 0; ++d)
+    {
+        auto& bucket = buckets[d % buckets.size()];
+
+        // Zero-weight transitions append to the current bucket, such that it is processed by index.
+        for (size_t i = 0; i < bucket.size(); ++i)
+        {
+            const auto v = bucket[i];
+            --num_queued;
+
+            if (distances[v] != d)
+                continue;
+
+            for (auto e = offsets[v]; e < offsets[v + 1]; ++e)
+            {
+                const auto u = sources[e];
+                const auto alternative = d + uint_t(weights[transitions[e]]);
+                if (alternative < distances[u])
+                {
+                    distances[u] = alternative;
+                    buckets[alternative % buckets.size()].push_back(u);
+                    ++num_queued;
+                }
+            }
+        }
+        bucket.clear();
+    }
+
+    auto result = std::vector<float_t>(g.num_vertices(), std::numeric_limits<float_t>::infinity());
+    for (uint_t v = 0; v < g.num_vertices(); ++v)
+        if (distances[v] != unreached)
+            result[v] = distances[v];
+
+    return result;
+}
+
+/// @brief A monotone priority queue over nonnegative floating-point keys.
+///
+/// The bit patterns of nonnegative IEEE 754 numbers are ordered like the numbers, such that the keys are bucketed by the
+/// highest bit in which they differ from the last extracted key. Each entry is moved to a lower bucket at most once per bit.
+class RadixHeap
+{
+public:
+    RadixHeap() : m_buckets(), m_last(0), m_size(0) {}
+
+    void push(float_t key, uint_t value)
+    {
+        assert(key >= 0 && to_bits(key) >= m_last);
+        const auto bits = to_bits(key);
+        m_buckets[get_bucket(bits)].emplace_back(bits, value);
+        ++m_size;
+    }
+
+    /// @brief Remove an entry with the smallest key and return it.
+    std::pair<float_t, uint_t> pop()
+    {
+        assert(!empty());
+
+        if (m_buckets[0].empty())
+        {
+            auto i = size_t(1);
+            while (m_buckets[i].empty())
+                ++i;
+
+            auto& bucket = m_buckets[i];
+            m_last = std::min_element(bucket.begin(), bucket.end())->first;
+            for (const auto& entry : bucket)
+                m_buckets[get_bucket(entry.first)].push_back(entry);
+            bucket.clear();
+        }
+
+        const auto [bits, value] = m_buckets[0].back();
+        m_buckets[0].pop_back();
+        --m_size;
+
+        return { std::bit_cast<float_t>(bits), value };
+    }
+
+    bool empty() const noexcept { return m_size == 0; }
+
+private:
+    static uint64_t to_bits(float_t key) noexcept { return std::bit_cast<uint64_t>(key); }
+
+    size_t get_bucket(uint64_t bits) const noexcept { return bits == m_last ? 0 : 64 - std::countl_zero(bits ^ m_last); }
+
+    std::array<std::vector<std::pair<uint64_t, uint_t>>, 65> m_buckets;
+    uint64_t m_last;
+    size_t m_size;
+};
+
+static_assert(sizeof(float_t) == sizeof(uint64_t));
+
+/// @brief Dijkstra's algorithm with a radix heap for general nonnegative weights.
+template<typename Graph>
+std::vector<float_t> compute_goal_distances_radix_heap(const Graph& g, std::span<const float_t> weights)
+{
+    auto distances = std::vector<float_t>(g.num_vertices(), std::numeric_limits<float_t>::infinity());
+    auto queue = RadixHeap();
+
+    for (const auto v : g.goal_vertices())
+    {
+        distances[v] = 0;
+        queue.push(float_t { 0 }, v);
+    }
+
+    const auto& offsets = g.offsets();
+    const auto& sources = g.sources();
+    const auto& transitions = g.transitions();
+
+    while (!queue.empty())
+    {
+        const auto [distance, v] = queue.pop();
+        if (distance > distances[v])
+            continue;
+
+        for (auto e = offsets[v]; e < offsets[v + 1]; ++e)
+        {
+            const auto u = sources[e];
+            const auto alternative = distance + weights[transitions[e]];
+            if (alternative < distances[u])
+            {
+                distances[u] = alternative;
+                queue.push(alternative, u);
+            }
+        }
+    }
+
+    return distances;
+}
+
+/// @brief Compute the goal distance of each vertex with the cheapest algorithm that supports the weights.
+template<typename Graph>
+std::vector<float_t> compute_goal_distances(const Graph& g, std::span<const float_t> weights)
+{
+    assert(weights.size() == g.num_edges());
+    assert(std::all_of(weights.begin(), weights.end(), [](const auto w) { return w >= 0; }));
+
+    switch (select_distance_algorithm(weights))
+    {
+        case DistanceAlgorithm::BFS:
+            return compute_goal_distances_bfs(g, weights.empty() ? float_t { 1 } : weights.front());
+        case DistanceAlgorithm::DIAL:
+            return compute_goal_distances_dial(g, weights, uint_t(*std::max_element(weights.begin(), weights.end())));
+        default:
+            return compute_goal_distances_radix_heap(g, weights);
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_ABSTRACTIONS_DISTANCE_TABLE_HPP_
+#define TYR_PLANNING_ABSTRACTIONS_DISTANCE_TABLE_HPP_
+
+#include "tyr/common/config.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace tyr::planning
+{
+
+/// @brief The goal distances of the abstract states of an abstraction, indexed by their rank.
+///
+/// Integral distances are stored at the smallest width of 8 or 16 bits that represents the largest finite distance,
+/// where the largest value of the width encodes infinity. Other distances are stored at full width.
+/// Ranks beyond the table, such as ProjectionMapping::dead_end_rank(), have infinite distance.
+class DistanceTable
+{
+public:
+    enum class Width : uint8_t
+    {
+        BITS_8,
+        BITS_16,
+        FULL,
+    };
+
+    DistanceTable() = default;
+
+    explicit DistanceTable(const std::vector<float_t>& distances) : m_width(compute_width(distances)),
+        m_size(distances.size()),
+        m_bits_8(),
+        m_bits_16(),
+        m_full()
+    {
+        switch (m_width)
+        {
+            case Width::BITS_8:
+                m_bits_8 = quantize<uint8_t>(distances);
+                break;
+            case Width::BITS_16:
+                m_bits_16 = quantize<uint16_t>(distances);
+                break;
+            case Width::FULL:
+                m_full = distances;
+                break;
+        }
+    }
+
+    float_t operator[](uint_t abstract_state) const noexcept
+    {
+        if (abstract_state >= m_size)
+            return std::numeric_limits<float_t>::infinity();
+
+        switch (m_width)
+        {
+            case Width::BITS_8:
+                return dequantize(m_bits_8[abstract_state]);
+            case Width::BITS_16:
+                return dequantize(m_bits_16[abstract_state]);
+            default:
+                return m_full[abstract_state];
+        }
+    }
+
+    Width get_width() const noexcept { return m_width; }
+    size_t size() const noexcept { return m_size; }
+    size_t memory_usage() const noexcept
+    {
+        return m_bits_8.capacity() * sizeof(uint8_t) + m_bits_16.capacity() * sizeof(uint16_t) + m_full.capacity() * sizeof(float_t);
+    }
+
+private:
+    static Width compute_width(const std::vector<float_t>& distances) noexcept
+    {
+        auto max_distance = float_t { 0 };
+        for (const auto distance : distances)
+        {
+            if (distance == std::numeric_limits<float_t>::infinity())
+                continue;
+            if (distance < 0 || distance != std::floor(distance))
+                return Width::FULL;
+            max_distance = std::max(max_distance, distance);
+        }
+
+        if (max_distance < std::numeric_limits<uint8_t>::max())
+            return Width::BITS_8;
+        if (max_distance < std::numeric_limits<uint16_t>::max())
+            return Width::BITS_16;
+        return Width::FULL;
+    }
+
+    template<typename T>
+    static std::vector<T> quantize(const std::vector<float_t>& distances)
+    {
+        auto result = std::vector<T>(distances.size());
+        for (size_t i = 0; i < distances.size(); ++i)
+            result[i] = (distances[i] == std::numeric_limits<float_t>::infinity()) ? std::numeric_limits<T>::max() : T(distances[i]);
+        return result;
+    }
+
+    template<typename T>
+    static float_t dequantize(T value) noexcept
+    {
+        return (value == std::numeric_limits<T>::max()) ? std::numeric_limits<float_t>::infinity() : float_t(value);
+    }
+
+    Width m_width = Width::FULL;
+    size_t m_size = 0;
+    std::vector<uint8_t> m_bits_8;
+    std::vector<uint16_t> m_bits_16;
+    std::vector<float_t> m_full;
+};
+
+/// @brief Look up one distance in each table, i.e., out_values[i] = tables[i][abstract_states[i]].
+///
+/// The lookups are independent, such that their memory accesses overlap, unlike lookups interleaved with computing the abstract states.
+inline void gather(std::span<const DistanceTable* const> tables, std::span<const uint_t> abstract_states, std::span<float_t> out_values) noexcept
+{
+    assert(tables.size() == abstract_states.size() && tables.size() == out_values.size());
+
+    for (size_t i = 0; i < tables.size(); ++i)
+        out_values[i] = (*tables[i])[abstract_states[i]];
+}
+
+}
+
+#endif
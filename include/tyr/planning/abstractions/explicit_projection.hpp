@@ -24,6 +24,8 @@
 #include "tyr/formalism/planning/views.hpp"
 #include "tyr/formalism/unification/substitution.hpp"
 #include "tyr/graphs/concepts.hpp"
+#include "tyr/planning/abstractions/distance_engine.hpp"
+#include "tyr/planning/abstractions/distance_table.hpp"
 #include "tyr/planning/abstractions/pattern_generator.hpp"
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/state_view.hpp"
@@ -31,12 +33,22 @@
 #include <boost/graph/graph_concepts.hpp>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/iterator/counting_iterator.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace tyr::planning
 {
 
-struct Transition
+/// @brief The label of abstract transitions: an action of the projected task and the substitution over the parameters of its original action.
+struct TransitionLabel
 {
     // The projected action is still useful for executing inside the projected task.
     formalism::planning::ActionView projected_action;
@@ -47,13 +59,57 @@ struct Transition
     // Substitution over the original action parameters.
     // Unbound parameters represent "any".
     formalism::unification::SubstitutionFunction<Index<formalism::Object>> substitution;
+};
+
+using TransitionLabelList = std::vector<TransitionLabel>;
+
+/// @brief Return whether two substitutions agree on all parameters that both of them bind.
+template<typename T>
+bool are_compatible(const formalism::unification::SubstitutionFunction<T>& lhs, const formalism::unification::SubstitutionFunction<T>& rhs)
+{
+    for (const auto p : lhs.parameters())
+    {
+        const auto* lhs_slot = lhs.try_get(p);
+        const auto* rhs_slot = rhs.try_get(p);
+
+        if (lhs_slot == nullptr || rhs_slot == nullptr)
+            continue;
+
+        if (!lhs_slot->has_value() || !rhs_slot->has_value())
+            continue;
+
+        if (**lhs_slot != **rhs_slot)
+            return false;
+    }
+
+    return true;
+}
 
+/// @brief Return whether two labels can represent a common ground action, i.e., they have the same original action and compatible substitutions.
+inline bool are_compatible(const TransitionLabel& lhs, const TransitionLabel& rhs)
+{
+    return lhs.original_action.get_index() == rhs.original_action.get_index() && are_compatible(lhs.substitution, rhs.substitution);
+}
+
+/// @brief An abstract transition before it is compressed into a ForwardProjectionAbstraction.
+struct Transition
+{
     uint_t src;
     uint_t dst;
+    uint_t label;  ///< the index of the label in the TransitionLabelList
 };
 
 using TransitionList = std::vector<Transition>;
 
+/// @brief Maps states to the abstract states of a projection onto a pattern.
+///
+/// The pattern facts are partitioned into groups of which at most one fact holds in any state:
+/// the facts on the same FDR variable, merged with the facts whose atoms lie in the same given mutex group.
+/// An abstract state assigns each group either none of its facts (digit 0) or its j-th fact (digit j + 1).
+/// Abstract states are ranked by the mixed-radix perfect hash over these digits, such that the abstract state space
+/// only contains the mutex-consistent assignments, i.e., the product of (group size + 1) over all groups.
+/// For lifted tasks without mutex groups, each group is a single fact and the rank is the bitmask over the pattern facts.
+/// States in which several facts of a group hold violate a mutex and map to dead_end_rank(), whose goal distance is infinite.
 template<TaskKind Kind>
 class ProjectionMapping
 {
@@ -66,125 +122,396 @@ public:
 
     using ActionMapping = UnorderedMap<formalism::planning::ActionView, ProjectedActionInfo>;
 
-    explicit ProjectionMapping(Pattern pattern) : m_pattern(std::move(pattern)) {}
+    struct FactGroup
+    {
+        std::vector<uint_t> positions;  ///< the positions of the facts in the pattern
+        uint_t multiplier;
+
+        uint_t radix() const noexcept { return positions.size() + 1; }
+    };
+
+    /// @param mutex_groups are pairwise disjoint sets of pairwise mutex atoms, e.g., obtained by invariant synthesis.
+    explicit ProjectionMapping(Pattern pattern, const std::vector<formalism::planning::GroundAtomViewList<formalism::FluentTag>>& mutex_groups = {}) :
+        m_pattern(std::move(pattern)),
+        m_groups(),
+        m_groups_by_variable(),
+        m_rank_contributions(),
+        m_num_abstract_states(1)
+    {
+        auto mutex_group_of_atom = UnorderedMap<formalism::planning::GroundAtomView<formalism::FluentTag>, uint_t> {};
+        for (uint_t g = 0; g < mutex_groups.size(); ++g)
+            for (const auto atom : mutex_groups[g])
+                mutex_group_of_atom.emplace(atom, g);
+
+        // Collect the positions by variable in the order of their first occurrence in the pattern.
+        auto variables = std::vector<Index<formalism::planning::FDRVariable<formalism::FluentTag>>> {};
+        auto positions_by_variable = UnorderedMap<Index<formalism::planning::FDRVariable<formalism::FluentTag>>, std::vector<uint_t>> {};
+        for (uint_t i = 0; i < m_pattern.size(); ++i)
+        {
+            const auto variable = m_pattern.facts[i].get_data().variable;
+            auto& positions = positions_by_variable[variable];
+            if (positions.empty())
+                variables.push_back(variable);
+            positions.push_back(i);
+        }
+
+        // The facts of a variable are merged into the group of a mutex group that contains all of their atoms.
+        const auto get_mutex_group = [&](const std::vector<uint_t>& positions) -> std::optional<uint_t>
+        {
+            auto result = std::optional<uint_t> {};
+            for (const auto i : positions)
+            {
+                const auto atom = m_pattern.facts[i].get_atom();
+                const auto it = atom.has_value() ? mutex_group_of_atom.find(atom.value()) : mutex_group_of_atom.end();
+                if (it == mutex_group_of_atom.end() || (result.has_value() && *result != it->second))
+                    return std::nullopt;
+                result = it->second;
+            }
+            return result;
+        };
+
+        auto group_of_mutex_group = UnorderedMap<uint_t, uint_t> {};
+        for (const auto variable : variables)
+        {
+            const auto& positions = positions_by_variable.at(variable);
+            const auto mutex_group = get_mutex_group(positions);
+
+            auto g = uint_t(m_groups.size());
+            if (mutex_group.has_value())
+                g = group_of_mutex_group.emplace(*mutex_group, g).first->second;
+            if (g == m_groups.size())
+                m_groups.push_back(FactGroup { {}, 0 });
+
+            m_groups[g].positions.insert(m_groups[g].positions.end(), positions.begin(), positions.end());
+            m_groups_by_variable[variable].push_back(g);
+        }
+
+        for (auto& group : m_groups)
+        {
+            std::sort(group.positions.begin(), group.positions.end());
+
+            group.multiplier = m_num_abstract_states;
+            if (uint64_t(m_num_abstract_states) * group.radix() > std::numeric_limits<uint_t>::max())
+                throw std::runtime_error("ProjectionMapping::ProjectionMapping(...): the abstract state space of the pattern is too large.");
+            m_num_abstract_states *= group.radix();
+        }
+
+        // The facts of a group are mutex, such that the digit of a group is the sum of the contributions of its variables.
+        for (const auto variable : variables)
+        {
+            auto contributions = std::vector<RankContribution> {};
+            for (const auto g : m_groups_by_variable.at(variable))
+            {
+                const auto& group = m_groups[g];
+                for (uint_t j = 0; j < group.positions.size(); ++j)
+                {
+                    const auto fact = m_pattern.facts[group.positions[j]].get_data();
+                    if (fact.variable != variable)
+                        continue;
+                    const auto value = uint_t(fact.value);
+                    if (value >= contributions.size())
+                        contributions.resize(value + 1);
+                    contributions[value] = RankContribution { (j + 1) * group.multiplier, g };
+                }
+            }
+            m_rank_contributions.emplace_back(variable, std::move(contributions));
+        }
+    }
 
+    /// @brief Map the state to its abstract state, or to dead_end_rank() if several facts of a group hold in it.
     uint_t map_state(const StateView<Kind>& state) const noexcept
     {
-        // Mimics the indexing obtained via itertools::for_each_boolean_vector used during construction of the ForwardProjectionAbstraction.
-        const auto k = m_pattern.size();
         auto r = uint_t(0);
-        for (uint_t i = 0; i < k; ++i)
+        auto groups = uint64_t(0);
+        for (const auto& [variable, contributions] : m_rank_contributions)
         {
-            const auto fact = m_pattern.facts[i];
-            const auto variable = fact.get_variable();
-            const auto value = fact.get_value();
-            if (state.get(variable) == value)
-                r |= (uint_t(1) << i);
+            const auto value = uint_t(state.get(variable));
+            if (value >= contributions.size() || contributions[value].rank == 0)
+                continue;
+
+            const auto group = uint64_t(1) << contributions[value].group;
+            if (groups & group)
+                return dead_end_rank();
+
+            groups |= group;
+            r += contributions[value].rank;
         }
+        assert(r < m_num_abstract_states);
         return r;
     }
 
+    /// @brief Map the successor obtained by applying `action` in a state that maps to `abstract_state`.
+    ///
+    /// Only the digits of the groups with facts on variables that occur in an effect of the action are recomputed in the successor.
+    uint_t map_successor_state(uint_t abstract_state, formalism::planning::GroundActionView action, const StateView<Kind>& succ_state) const noexcept
+    {
+        if (abstract_state == dead_end_rank())
+            return map_state(succ_state);
+
+        auto r = abstract_state;
+        auto is_dead_end = false;
+
+        const auto update = [&](auto&& facts)
+        {
+            for (const auto fact : facts)
+            {
+                const auto it = m_groups_by_variable.find(fact.get_data().variable);
+                if (it == m_groups_by_variable.end())
+                    continue;
+
+                for (const auto g : it->second)
+                {
+                    const auto& group = m_groups[g];
+                    const auto digit = compute_digit(group, succ_state);
+                    if (digit == group.radix())
+                    {
+                        is_dead_end = true;
+                        return;
+                    }
+                    r -= get_digit(r, group) * group.multiplier;
+                    r += digit * group.multiplier;
+                }
+            }
+        };
+
+        for (const auto cond_effect : action.get_effects())
+        {
+            const auto effect = cond_effect.get_effect();
+            update(effect.template get_facts<formalism::PositiveTag>());
+            update(effect.template get_facts<formalism::NegativeTag>());
+        }
+
+        return is_dead_end ? dead_end_rank() : r;
+    }
+
+    /// @brief Call `callback` with the position of each pattern fact that holds in the abstract state.
+    template<typename Callback>
+    void for_each_fact(uint_t abstract_state, Callback&& callback) const
+    {
+        for (const auto& group : m_groups)
+        {
+            const auto digit = get_digit(abstract_state, group);
+            if (digit > 0)
+                callback(group.positions[digit - 1]);
+        }
+    }
+
+    const auto& get_pattern() const noexcept { return m_pattern; }
+    const auto& get_groups() const noexcept { return m_groups; }
+    uint_t num_abstract_states() const noexcept { return m_num_abstract_states; }
+    /// @brief The rank of the states that violate a mutex, which is not the rank of an abstract state.
+    uint_t dead_end_rank() const noexcept { return m_num_abstract_states; }
+
 private:
+    static uint_t get_digit(uint_t abstract_state, const FactGroup& group) noexcept { return (abstract_state / group.multiplier) % group.radix(); }
+
+    /// @brief Compute the digit of the group in the state, or the radix of the group if several of its facts hold.
+    uint_t compute_digit(const FactGroup& group, const StateView<Kind>& state) const noexcept
+    {
+        auto digit = uint_t(0);
+        for (uint_t j = 0; j < group.positions.size(); ++j)
+        {
+            const auto fact = m_pattern.facts[group.positions[j]].get_data();
+            if (state.get(fact.variable) == fact.value)
+            {
+                if (digit > 0)
+                    return group.radix();
+                digit = j + 1;
+            }
+        }
+        return digit;
+    }
+
+    struct RankContribution
+    {
+        uint_t rank = 0;   ///< the rank contribution of the fact, or 0 if the value is not a pattern fact
+        uint_t group = 0;  ///< the group of the fact
+    };
+
     Pattern m_pattern;
+    std::vector<FactGroup> m_groups;
+    UnorderedMap<Index<formalism::planning::FDRVariable<formalism::FluentTag>>, std::vector<uint_t>> m_groups_by_variable;
+    /// The rank contribution of each value of each pattern variable, indexed by value.
+    std::vector<std::pair<Index<formalism::planning::FDRVariable<formalism::FluentTag>>, std::vector<RankContribution>>> m_rank_contributions;
+    uint_t m_num_abstract_states;
 };
 
+/// @brief The transition system of a projection in compressed sparse row format.
+///
+/// The transitions are numbered in the order of their sources, such that the transitions with source s are [offsets[s], offsets[s + 1]).
+/// Each transition only stores its target and the index of its label; the labels are interned, since a label usually induces
+/// a transition in many abstract states.
 template<TaskKind Kind>
 class ForwardProjectionAbstraction
 {
 public:
     using IndexingMode = graphs::ContiguousIndexingTag;
 
-    static boost::dynamic_bitset<> compute_state_changing_transitions(const TransitionList& transitions)
+    /// @brief The vertices are the ranks of the abstract states, see ProjectionMapping.
+    ForwardProjectionAbstraction(ProjectionMapping<Kind> mapping, TransitionLabelList labels, const TransitionList& transitions, std::vector<uint_t> goal_vertices) :
+        m_mapping(std::move(mapping)),
+        m_labels(std::move(labels)),
+        m_offsets(m_mapping.num_abstract_states() + 1, 0),
+        m_targets(transitions.size()),
+        m_transition_labels(transitions.size()),
+        m_goal_vertices(std::move(goal_vertices))
     {
-        auto result = boost::dynamic_bitset<>(transitions.size());
-        for (uint_t t = 0; t < transitions.size(); ++t)
+        // Counting sort by source, which keeps the order of the transitions of each source.
+        for (const auto& transition : transitions)
+            ++m_offsets[transition.src + 1];
+        for (uint_t v = 0; v < num_vertices(); ++v)
+            m_offsets[v + 1] += m_offsets[v];
+
+        auto next = std::vector<uint_t>(m_offsets.begin(), m_offsets.end() - 1);
+        for (const auto& transition : transitions)
         {
-            const auto& transition = transitions[t];
-            if (transition.src != transition.dst)
-                result.set(t);
+            assert(transition.label < m_labels.size());
+            const auto t = next[transition.src]++;
+            m_targets[t] = transition.dst;
+            m_transition_labels[t] = transition.label;
         }
-        return result;
-    }
-
-    ForwardProjectionAbstraction(ProjectionMapping<Kind> mapping,
-                                 std::shared_ptr<StateRepository<Kind>> state_repository,
-                                 std::vector<StateView<Kind>> vertices,
-                                 TransitionList transitions,
-                                 std::vector<std::vector<uint_t>> adj_lists,
-                                 std::vector<uint_t> goal_vertices) :
-        m_mapping(std::move(mapping)),
-        m_state_repository(std::move(state_repository)),
-        m_vertices(std::move(vertices)),
-        m_transitions(std::move(transitions)),
-        m_adj_lists(std::move(adj_lists)),
-        m_goal_vertices(std::move(goal_vertices)),
-        m_state_changing_transitions(compute_state_changing_transitions(m_transitions))
-    {
     }
 
     const auto& get_mapping() const noexcept { return m_mapping; }
-    const auto& state_repository() const noexcept { return m_state_repository; }
-    auto num_vertices() const noexcept { return m_vertices.size(); }
-    auto num_edges() const noexcept { return m_transitions.size(); }
-    const auto& vertices() const noexcept { return m_vertices; }
-    const auto& transitions() const noexcept { return m_transitions; }
-    const auto& adj_lists() const noexcept { return m_adj_lists; }
+    auto num_vertices() const noexcept { return size_t(m_mapping.num_abstract_states()); }
+    auto num_edges() const noexcept { return m_targets.size(); }
+
+    /// @brief Get the range of the transitions with source v.
+    auto get_transitions(uint_t v) const noexcept { return std::views::iota(m_offsets[v], m_offsets[v + 1]); }
+    uint_t get_source(uint_t t) const noexcept { return uint_t(std::upper_bound(m_offsets.begin(), m_offsets.end(), t) - m_offsets.begin()) - 1; }
+    uint_t get_target(uint_t t) const noexcept { return m_targets[t]; }
+    uint_t get_label_index(uint_t t) const noexcept { return m_transition_labels[t]; }
+    const auto& get_label(uint_t t) const noexcept { return m_labels[m_transition_labels[t]]; }
+
+    const auto& labels() const noexcept { return m_labels; }
+    const auto& offsets() const noexcept { return m_offsets; }
     const auto& goal_vertices() const noexcept { return m_goal_vertices; }
-    const auto& state_changing_transitions() const noexcept { return m_state_changing_transitions; }
+
+    size_t memory_usage() const noexcept
+    {
+        return (m_offsets.capacity() + m_targets.capacity() + m_transition_labels.capacity() + m_goal_vertices.capacity()) * sizeof(uint_t)
+               + m_labels.capacity() * sizeof(TransitionLabel);
+    }
 
 private:
     ProjectionMapping<Kind> m_mapping;
-    std::shared_ptr<StateRepository<Kind>> m_state_repository;
-    std::vector<StateView<Kind>> m_vertices;
-    TransitionList m_transitions;
-    std::vector<std::vector<uint_t>> m_adj_lists;
+    TransitionLabelList m_labels;
+
+    std::vector<uint_t> m_offsets;
+    std::vector<uint_t> m_targets;
+    std::vector<uint_t> m_transition_labels;
+
     std::vector<uint_t> m_goal_vertices;
-    boost::dynamic_bitset<> m_state_changing_transitions;
 };
 
+/// @brief The reversed transition system of a projection in compressed sparse row format.
+///
+/// The entries with target v are [offsets[v], offsets[v + 1]), and each entry stores the source and the index of the forward transition.
 template<TaskKind Kind>
 class BackwardProjectionAbstraction
 {
 public:
     using IndexingMode = graphs::ContiguousIndexingTag;
 
-    explicit BackwardProjectionAbstraction(std::shared_ptr<const ForwardProjectionAbstraction<Kind>> g) : m_g(g), m_adj_lists(g->num_vertices())
+    explicit BackwardProjectionAbstraction(std::shared_ptr<const ForwardProjectionAbstraction<Kind>> g) :
+        m_g(std::move(g)),
+        m_offsets(m_g->num_vertices() + 1, 0),
+        m_sources(m_g->num_edges()),
+        m_transitions(m_g->num_edges())
     {
-        for (uint_t t = 0; t < g->num_edges(); ++t)
-            m_adj_lists[g->transitions()[t].dst].push_back(t);
+        for (uint_t t = 0; t < m_g->num_edges(); ++t)
+            ++m_offsets[m_g->get_target(t) + 1];
+        for (uint_t v = 0; v < num_vertices(); ++v)
+            m_offsets[v + 1] += m_offsets[v];
+
+        auto next = std::vector<uint_t>(m_offsets.begin(), m_offsets.end() - 1);
+        for (uint_t v = 0; v < num_vertices(); ++v)
+        {
+            for (const auto t : m_g->get_transitions(v))
+            {
+                const auto e = next[m_g->get_target(t)]++;
+                m_sources[e] = v;
+                m_transitions[e] = t;
+            }
+        }
     }
 
     auto num_vertices() const noexcept { return m_g->num_vertices(); }
     auto num_edges() const noexcept { return m_g->num_edges(); }
-    const auto& vertices() const noexcept { return m_g->vertices(); }
-    const auto& transitions() const noexcept { return m_g->transitions(); }
     const auto& goal_vertices() const noexcept { return m_g->goal_vertices(); }
-    const auto& adj_lists() const noexcept { return m_adj_lists; }
+    const auto& offsets() const noexcept { return m_offsets; }
+    const auto& sources() const noexcept { return m_sources; }
+    const auto& transitions() const noexcept { return m_transitions; }
     const auto& g() const noexcept { return *m_g; }
 
+    size_t memory_usage() const noexcept { return (m_offsets.capacity() + m_sources.capacity() + m_transitions.capacity()) * sizeof(uint_t); }
+
 private:
     std::shared_ptr<const ForwardProjectionAbstraction<Kind>> m_g;
 
-    std::vector<std::vector<uint_t>> m_adj_lists;
+    std::vector<uint_t> m_offsets;
+    std::vector<uint_t> m_sources;
+    std::vector<uint_t> m_transitions;
 };
 
+/// @brief Compute the costs of the transitions from the costs of their labels.
+template<TaskKind Kind>
+std::vector<float_t> get_transition_costs(const ForwardProjectionAbstraction<Kind>& g, const std::vector<float_t>& label_costs)
+{
+    assert(label_costs.size() == g.labels().size());
+
+    auto result = std::vector<float_t>(g.num_edges());
+    for (uint_t t = 0; t < g.num_edges(); ++t)
+        result[t] = label_costs[g.get_label_index(t)];
+    return result;
+}
+
 template<TaskKind Kind>
 class ProjectionAbstraction
 {
 public:
     using IndexingMode = graphs::ContiguousIndexingTag;
 
-    explicit ProjectionAbstraction(std::shared_ptr<const ForwardProjectionAbstraction<Kind>> forward) : m_forward(std::move(forward)), m_backward(m_forward) {}
+    /// @brief Construct with unit action costs.
+    explicit ProjectionAbstraction(std::shared_ptr<const ForwardProjectionAbstraction<Kind>> forward) :
+        ProjectionAbstraction(forward, std::vector<float_t>(forward->labels().size(), float_t { 1 }))
+    {
+    }
+
+    /// @param label_costs are the nonnegative costs of the labels, i.e., lower bounds on the costs of the actions they represent.
+    ProjectionAbstraction(std::shared_ptr<const ForwardProjectionAbstraction<Kind>> forward, std::vector<float_t> label_costs) :
+        m_forward(std::move(forward)),
+        m_backward(m_forward),
+        m_label_costs(std::move(label_costs)),
+        m_distances(std::make_shared<const DistanceTable>(compute_goal_distances(m_backward, get_transition_costs(*m_forward, m_label_costs))))
+    {
+    }
+
+    /// @brief Construct with previously computed goal distances, e.g., loaded from a cache.
+    ProjectionAbstraction(std::shared_ptr<const ForwardProjectionAbstraction<Kind>> forward,
+                          std::vector<float_t> label_costs,
+                          std::shared_ptr<const DistanceTable> distances) :
+        m_forward(std::move(forward)),
+        m_backward(m_forward),
+        m_label_costs(std::move(label_costs)),
+        m_distances(std::move(distances))
+    {
+        assert(m_label_costs.size() == m_forward->labels().size());
+        assert(m_distances->size() == m_forward->num_vertices());
+    }
 
     const auto& get_mapping() const noexcept { return m_forward->get_mapping(); }
-    const auto& state_changing_transitions() const noexcept { return m_forward->state_changing_transitions(); }
-    const auto& transitions() const noexcept { return m_forward->transitions(); }
+    const auto& labels() const noexcept { return m_forward->labels(); }
+    const auto& get_label_costs() const noexcept { return m_label_costs; }
     const auto& get_forward() const noexcept { return *m_forward; }
     const auto& get_backward() const noexcept { return m_backward; }
+    const auto& get_distances() const noexcept { return m_distances; }
 
 private:
     std::shared_ptr<const ForwardProjectionAbstraction<Kind>> m_forward;
     BackwardProjectionAbstraction<Kind> m_backward;
+    std::vector<float_t> m_label_costs;
+    std::shared_ptr<const DistanceTable> m_distances;
 };
 
 template<TaskKind Kind>
@@ -221,56 +548,58 @@ auto vertices(const BackwardProjectionAbstraction<Kind>& g)
 
 /**
  * IncidenceGraph
+ *
+ * The edges are the positions in the compressed rows, such that out_edges is a contiguous range.
  */
 
 template<TaskKind Kind>
 auto out_edges(uint_t v, const ForwardProjectionAbstraction<Kind>& g)
 {
-    const auto& r = g.adj_lists().at(v);
-    return std::make_pair(r.begin(), r.end());
+    using It = boost::counting_iterator<uint_t>;
+    return std::make_pair(It { g.offsets()[v] }, It { g.offsets()[v + 1] });
 }
 
 template<TaskKind Kind>
 auto source(uint_t e, const ForwardProjectionAbstraction<Kind>& g)
 {
-    return g.transitions().at(e).src;
+    return g.get_source(e);
 }
 
 template<TaskKind Kind>
 auto target(uint_t e, const ForwardProjectionAbstraction<Kind>& g)
 {
-    return g.transitions().at(e).dst;
+    return g.get_target(e);
 }
 
 template<TaskKind Kind>
 auto out_degree(uint_t v, const ForwardProjectionAbstraction<Kind>& g)
 {
-    return g.adj_lists().at(v).size();
+    return size_t(g.offsets()[v + 1] - g.offsets()[v]);
 }
 
 template<TaskKind Kind>
 auto out_edges(uint_t v, const BackwardProjectionAbstraction<Kind>& g)
 {
-    const auto& r = g.adj_lists().at(v);
-    return std::make_pair(r.begin(), r.end());
+    using It = boost::counting_iterator<uint_t>;
+    return std::make_pair(It { g.offsets()[v] }, It { g.offsets()[v + 1] });
 }
 
 template<TaskKind Kind>
 auto source(uint_t e, const BackwardProjectionAbstraction<Kind>& g)
 {
-    return g.transitions().at(e).dst;
+    return g.g().get_target(g.transitions()[e]);
 }
 
 template<TaskKind Kind>
 auto target(uint_t e, const BackwardProjectionAbstraction<Kind>& g)
 {
-    return g.transitions().at(e).src;
+    return g.sources()[e];
 }
 
 template<TaskKind Kind>
 auto out_degree(uint_t v, const BackwardProjectionAbstraction<Kind>& g)
 {
-    return g.adj_lists().at(v).size();
+    return size_t(g.offsets()[v + 1] - g.offsets()[v]);
 }
 
 }
@@ -297,7 +626,7 @@ struct graph_traits<::tyr::planning::ForwardProjectionAbstraction<Kind>>
     using vertex_iterator = boost::counting_iterator<::tyr::uint_t>;
     using vertices_size_type = size_t;
     // boost::IncidenceGraph
-    using out_edge_iterator = typename std::vector<::tyr::uint_t>::const_iterator;
+    using out_edge_iterator = boost::counting_iterator<::tyr::uint_t>;
     using degree_size_type = size_t;
     // boost::strong_components
     constexpr static vertex_descriptor null_vertex() { return std::numeric_limits<vertex_descriptor>::max(); }
@@ -322,7 +651,7 @@ struct graph_traits<::tyr::planning::BackwardProjectionAbstraction<Kind>>
     using vertex_iterator = boost::counting_iterator<::tyr::uint_t>;
     using vertices_size_type = size_t;
     // boost::IncidenceGraph
-    using out_edge_iterator = typename std::vector<::tyr::uint_t>::const_iterator;
+    using out_edge_iterator = boost::counting_iterator<::tyr::uint_t>;
     using degree_size_type = size_t;
     // boost::strong_components
     constexpr static vertex_descriptor null_vertex() { return std::numeric_limits<vertex_descriptor>::max(); }
@@ -330,4 +659,4 @@ struct graph_traits<::tyr::planning::BackwardProjectionAbstraction<Kind>>
 
 }
 
-#endif
\ No newline at end of file
+#endif
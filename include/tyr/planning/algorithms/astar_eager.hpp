@@ -37,6 +37,7 @@ struct Options
     GoalStrategyPtr<Kind> goal_strategy = nullptr;
     uint_t max_num_states = std::numeric_limits<uint_t>::max();
     std::optional<std::chrono::steady_clock::duration> max_time = std::nullopt;
+    std::optional<size_t> max_memory = std::nullopt;  ///< in bytes
     uint64_t random_seed = 0;
     bool shuffle_labeled_succ_nodes = false;
 
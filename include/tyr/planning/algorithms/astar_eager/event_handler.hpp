@@ -227,7 +227,7 @@ public:
 };
 
 template<TaskKind Kind>
-class DefaultEventHandler : public EventHandlerBase<DefaultEventHandler<Kind>, Kind>
+class DefaultEventHandler final : public EventHandlerBase<DefaultEventHandler<Kind>, Kind>
 {
 private:
     /* Implement EventHandlerBase interface */
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_ALGORITHMS_BFWS_HPP_
+#define TYR_PLANNING_ALGORITHMS_BFWS_HPP_
+
+#include "tyr/planning/algorithms/utils.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace tyr::planning::bfws
+{
+
+template<TaskKind Kind>
+struct Options
+{
+    std::optional<Node<Kind>> start_node = std::nullopt;
+    gbfs_lazy::EventHandlerPtr<Kind> event_handler = nullptr;
+    PruningStrategyPtr<Kind> pruning_strategy = nullptr;
+    GoalStrategyPtr<Kind> goal_strategy = nullptr;
+    uint_t max_num_states = std::numeric_limits<uint_t>::max();
+    std::optional<std::chrono::steady_clock::duration> max_time = std::nullopt;
+    std::optional<size_t> max_memory = std::nullopt;  ///< in bytes
+    uint_t arity = 2;                                 ///< the largest tracked tuple size, i.e., 1 or 2
+    uint64_t random_seed = 0;
+    bool shuffle_labeled_succ_nodes = false;
+
+    Options() = default;
+};
+
+/// @brief Best-first width search: eager best-first search ordered by the novelty of a state
+/// among the states with the same h-value, with ties broken by the h-value.
+///
+/// With the goal count heuristic, this is BFWS(w_#g, #g).
+template<TaskKind Kind>
+SearchResult<Kind>
+find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& successor_generator, Heuristic<Kind>& heuristic, const Options<Kind>& options = Options<Kind>());
+}
+
+#endif
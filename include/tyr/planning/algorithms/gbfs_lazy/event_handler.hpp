@@ -48,8 +48,8 @@ public:
     /// @brief React on expanding a goal `node`.
     virtual void on_expand_goal_node(const Node<Kind>& node) = 0;
 
-    /// @brief React on generating a successor `node` by applying an action.
-    virtual void on_generate_node(const LabeledNode<Kind>& labeled_succ_node) = 0;
+    /// @brief React on generating a successor `succ_node` by applying the action `label`.
+    virtual void on_generate_node(formalism::planning::GroundActionView label, const Node<Kind>& succ_node) = 0;
 
     /// @brief React on pruning a node.
     virtual void on_prune_node(const Node<Kind>& node) = 0;
@@ -112,13 +112,13 @@ public:
             self().on_expand_goal_node_impl(node);
     }
 
-    void on_generate_node(const LabeledNode<Kind>& labeled_succ_node) override
+    void on_generate_node(formalism::planning::GroundActionView label, const Node<Kind>& succ_node) override
     {
         m_statistics.increment_num_generated();
 
         if (verbosity(2))
         {
-            self().on_generate_node_impl(labeled_succ_node);
+            self().on_generate_node_impl(label, succ_node);
         }
     }
 
@@ -193,7 +193,7 @@ public:
 };
 
 template<TaskKind Kind>
-class DefaultEventHandler : public EventHandlerBase<DefaultEventHandler<Kind>, Kind>
+class DefaultEventHandler final : public EventHandlerBase<DefaultEventHandler<Kind>, Kind>
 {
 private:
     /* Implement EventHandlerBase interface */
@@ -203,7 +203,7 @@ private:
 
     void on_expand_goal_node_impl(const Node<Kind>& node) const;
 
-    void on_generate_node_impl(const LabeledNode<Kind>& labeled_succ_node) const;
+    void on_generate_node_impl(formalism::planning::GroundActionView label, const Node<Kind>& succ_node) const;
 
     void on_prune_node_impl(const Node<Kind>& node) const;
 
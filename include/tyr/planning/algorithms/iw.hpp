@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_ALGORITHMS_IW_HPP_
+#define TYR_PLANNING_ALGORITHMS_IW_HPP_
+
+#include "tyr/planning/algorithms/utils.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace tyr::planning::iw
+{
+
+template<TaskKind Kind>
+struct Options
+{
+    std::optional<Node<Kind>> start_node = std::nullopt;
+    gbfs_lazy::EventHandlerPtr<Kind> event_handler = nullptr;  ///< reports a h-value of zero
+    PruningStrategyPtr<Kind> pruning_strategy = nullptr;
+    GoalStrategyPtr<Kind> goal_strategy = nullptr;
+    uint_t max_num_states = std::numeric_limits<uint_t>::max();
+    std::optional<std::chrono::steady_clock::duration> max_time = std::nullopt;
+    std::optional<size_t> max_memory = std::nullopt;  ///< in bytes
+    uint_t arity = 1;                                 ///< the width k, i.e., 1 or 2
+    uint64_t random_seed = 0;
+    bool shuffle_labeled_succ_nodes = false;
+
+    Options() = default;
+};
+
+/// @brief Iterated width IW(k): breadth-first search that prunes every generated state with a novelty greater than k.
+///
+/// The search is incomplete: it returns EXHAUSTED if no goal is reachable through novel states.
+template<TaskKind Kind>
+SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& successor_generator, const Options<Kind>& options = Options<Kind>());
+}
+
+#endif
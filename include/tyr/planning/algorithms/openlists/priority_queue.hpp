@@ -22,6 +22,7 @@
 
 #include <cassert>
 #include <queue>
+#include <vector>
 
 namespace tyr::planning
 {
@@ -43,6 +44,12 @@ private:
         bool operator()(const E& l, const E& r) { return l.get_key() > r.get_key(); }
     };
 
+    /// @brief Exposes the capacity of the underlying container for memory accounting.
+    struct Queue : public std::priority_queue<E, std::vector<E>, EntryComparator>
+    {
+        std::size_t capacity() const noexcept { return this->c.capacity(); }
+    };
+
 public:
     using EntryType = E;
     using KeyType = typename E::KeyType;
@@ -70,7 +77,7 @@ public:
 
     void clear()
     {
-        auto tmp = std::priority_queue<E, std::vector<E>, EntryComparator> {};
+        auto tmp = Queue {};
         std::swap(m_priority_queue, tmp);
     }
 
@@ -78,8 +85,10 @@ public:
 
     std::size_t size() const { return m_priority_queue.size(); }
 
+    std::size_t memory_usage() const noexcept { return m_priority_queue.capacity() * sizeof(E); }
+
 private:
-    std::priority_queue<E, std::vector<E>, EntryComparator> m_priority_queue;
+    Queue m_priority_queue;
 };
 
 }
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_ALGORITHMS_STRATEGIES_DISPATCH_HPP_
+#define TYR_PLANNING_ALGORITHMS_STRATEGIES_DISPATCH_HPP_
+
+#include "tyr/planning/algorithms/strategies/goal.hpp"
+#include "tyr/planning/algorithms/strategies/pruning.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/heuristic.hpp"
+#include "tyr/planning/heuristics/blind.hpp"
+#include "tyr/planning/heuristics/goal_count.hpp"
+
+namespace tyr::planning
+{
+
+/// @brief Call the search `callback` with the policies of a search.
+///
+/// The common configuration, i.e., a blind or goal count heuristic without pruning, with the task goal,
+/// and with the default event handler, is passed with its final types such that the search loop
+/// is instantiated without virtual calls. All other configurations are passed through their interfaces.
+template<typename DefaultEventHandlerType, TaskKind Kind, typename EventHandlerType, typename Callback>
+auto dispatch_search_policies(Heuristic<Kind>& heuristic,
+                              PruningStrategy<Kind>& pruning_strategy,
+                              GoalStrategy<Kind>& goal_strategy,
+                              EventHandlerType& event_handler,
+                              Callback&& callback)
+{
+    auto no_pruning_strategy = dynamic_cast<NoPruningStrategy<Kind>*>(&pruning_strategy);
+    auto task_goal_strategy = dynamic_cast<TaskGoalStrategy<Kind>*>(&goal_strategy);
+    auto default_event_handler = dynamic_cast<DefaultEventHandlerType*>(&event_handler);
+
+    if (no_pruning_strategy && task_goal_strategy && default_event_handler)
+    {
+        if (auto blind_heuristic = dynamic_cast<BlindHeuristic<Kind>*>(&heuristic))
+            return callback(*blind_heuristic, *no_pruning_strategy, *task_goal_strategy, *default_event_handler);
+
+        if (auto goal_count_heuristic = dynamic_cast<GoalCountHeuristic<Kind>*>(&heuristic))
+            return callback(*goal_count_heuristic, *no_pruning_strategy, *task_goal_strategy, *default_event_handler);
+    }
+
+    return callback(heuristic, pruning_strategy, goal_strategy, event_handler);
+}
+
+/// @brief Call the search `callback` with the policies of a search without a heuristic.
+template<typename DefaultEventHandlerType, TaskKind Kind, typename EventHandlerType, typename Callback>
+auto dispatch_search_policies(PruningStrategy<Kind>& pruning_strategy, GoalStrategy<Kind>& goal_strategy, EventHandlerType& event_handler, Callback&& callback)
+{
+    auto no_pruning_strategy = dynamic_cast<NoPruningStrategy<Kind>*>(&pruning_strategy);
+    auto task_goal_strategy = dynamic_cast<TaskGoalStrategy<Kind>*>(&goal_strategy);
+    auto default_event_handler = dynamic_cast<DefaultEventHandlerType*>(&event_handler);
+
+    if (no_pruning_strategy && task_goal_strategy && default_event_handler)
+        return callback(*no_pruning_strategy, *task_goal_strategy, *default_event_handler);
+
+    return callback(pruning_strategy, goal_strategy, event_handler);
+}
+
+}
+
+#endif
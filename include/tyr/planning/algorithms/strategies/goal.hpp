@@ -20,6 +20,7 @@
 
 #include "tyr/planning/applicability.hpp"
 #include "tyr/planning/declarations.hpp"
+#include "tyr/planning/state_handle.hpp"
 #include "tyr/planning/state_view.hpp"
 
 #include <memory>
@@ -38,7 +39,7 @@ public:
 };
 
 template<TaskKind Kind>
-class TaskGoalStrategy : public GoalStrategy<Kind>
+class TaskGoalStrategy final : public GoalStrategy<Kind>
 {
 public:
     TaskGoalStrategy(const Task<Kind>& task) : m_task(task) {}
@@ -48,8 +49,12 @@ public:
     bool is_static_goal_satisfied() override { return is_statically_applicable(m_task.get_task().get_goal(), m_task.get_static_atoms_bitset()); }
     bool is_dynamic_goal_satisfied(const StateView<Kind>& state) override
     {
-        const auto state_context = StateContext { m_task, state.get_unpacked_state(), float_t { 0 } };
-        return is_dynamically_applicable(m_task.get_task().get_goal(), state_context);
+        return is_dynamic_goal_satisfied(StateHandle<Kind>(m_task, state.get_unpacked_state()));
+    }
+
+    bool is_dynamic_goal_satisfied(StateHandle<Kind> state) const
+    {
+        return is_dynamically_applicable(m_task.get_task().get_goal(), state.get_context());
     }
 
 private:
@@ -39,6 +39,18 @@ public:
     virtual bool should_prune_successor_state(const StateView<Kind>& state, const StateView<Kind>& succ_state, bool is_new_succ) { return false; }
 };
 
+/// @brief The default strategy: never prunes, and is final such that statically dispatched searches inline it away.
+template<TaskKind Kind>
+class NoPruningStrategy final : public PruningStrategy<Kind>
+{
+public:
+    static std::shared_ptr<NoPruningStrategy<Kind>> create() { return std::make_shared<NoPruningStrategy<Kind>>(); }
+
+    bool should_prune_state(const StateView<Kind>& state) override { return false; }
+
+    bool should_prune_successor_state(const StateView<Kind>& state, const StateView<Kind>& succ_state, bool is_new_succ) override { return false; }
+};
+
 }
 
 #endif
@@ -83,7 +83,7 @@ float_t evaluate(formalism::planning::GroundMultiOperatorView<O> element, const
                            child_fexprs.end(),
                            evaluate(child_fexprs.front(), context),
                            [&](const auto& value, const auto& child_expr)
-                           { return formalism::apply(formalism::OpMul {}, value, evaluate(child_expr, context)); });
+                           { return formalism::apply(O {}, value, evaluate(child_expr, context)); });
 }
 
 template<TaskKind Kind>
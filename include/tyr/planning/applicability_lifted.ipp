@@ -81,7 +81,7 @@ float_t evaluate(formalism::planning::LiftedMultiOperatorView<O> element, const
                            child_fexprs.end(),
                            evaluate(child_fexprs.front(), context),
                            [&](const auto& value, const auto& child_expr)
-                           { return formalism::apply(formalism::OpMul {}, value, evaluate(child_expr, context)); });
+                           { return formalism::apply(O {}, value, evaluate(child_expr, context)); });
 }
 
 TYR_INLINE_IMPL float_t evaluate(formalism::planning::FunctionTermView<formalism::StaticTag> element, const ApplicabilityContext& context)
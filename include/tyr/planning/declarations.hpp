@@ -118,6 +118,8 @@ class ProjectionAbstraction;
 
 template<TaskKind Kind>
 class GoalPatternGenerator;
+template<TaskKind Kind>
+class HillClimbingPatternGenerator;
 }
 
 #endif
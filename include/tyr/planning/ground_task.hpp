@@ -26,7 +26,11 @@
 #include "tyr/formalism/planning/planning_fdr_task.hpp"
 #include "tyr/formalism/planning/views.hpp"  // for View
 #include "tyr/planning/declarations.hpp"
+#include "tyr/planning/ground_task/action_table.hpp"          // for GroundActionTable
+#include "tyr/planning/ground_task/axiom_stratification.hpp"  // for GroundAxiomStrata
+#include "tyr/planning/ground_task/bitset_matcher.hpp"        // for BitsetMatcherPtr
 #include "tyr/planning/ground_task/match_tree/match_tree.hpp"  // for Matc...
+#include "tyr/planning/ground_task/matcher_options.hpp"        // for ActionMatcherKind
 
 #include <boost/dynamic_bitset.hpp>  // for dynamic_bitset
 #include <limits>                    // for numeric_limits
@@ -40,7 +44,7 @@ template<>
 class Task<GroundTag>
 {
 public:
-    explicit Task(formalism::planning::PlanningFDRTask task);
+    explicit Task(formalism::planning::PlanningFDRTask task, ActionMatcherKind action_matcher = ActionMatcherKind::AUTOMATIC);
 
     template<formalism::FactKind T>
     size_t get_num_atoms() const noexcept;
@@ -62,7 +66,12 @@ public:
     const auto& get_repository() const noexcept { return m_task.get_repository(); }
     bool has_axioms() const noexcept { return !get_task().get_ground_axioms().empty(); }
 
+    /// @brief Exactly one of the action match tree and the action bitset matcher is non-null.
     const auto& get_action_match_tree() const noexcept { return m_action_match_tree; }
+    const auto& get_action_bitset_matcher() const noexcept { return m_action_bitset_matcher; }
+    const auto& get_action_table() const noexcept { return m_action_table; }
+    const auto& get_axiom_strata() const noexcept { return m_axiom_strata; }
+    /// @brief The match tree of each axiom stratum, which is null for recursive strata.
     const auto& get_axiom_match_tree_strata() const noexcept { return m_axiom_match_tree_strata; }
 
 private:
@@ -72,7 +81,10 @@ private:
     std::vector<float_t> m_static_numeric_variables;
 
     match_tree::MatchTreePtr<formalism::planning::GroundAction> m_action_match_tree;
+    BitsetMatcherPtr<formalism::planning::GroundAction> m_action_bitset_matcher;
+    GroundActionTable m_action_table;
 
+    GroundAxiomStrata m_axiom_strata;
     std::vector<match_tree::MatchTreePtr<formalism::planning::GroundAxiom>> m_axiom_match_tree_strata;
 };
 
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_GROUND_TASK_ACTION_TABLE_HPP_
+#define TYR_PLANNING_GROUND_TASK_ACTION_TABLE_HPP_
+
+#include "tyr/common/types.hpp"
+#include "tyr/formalism/numeric_bytecode.hpp"
+#include "tyr/formalism/planning/declarations.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <boost/dynamic_bitset.hpp>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace tyr::planning
+{
+
+/// @brief Flat struct-of-arrays compilation of the conditional effects of the ground actions of a task.
+///
+/// The conditional effects of an action are a contiguous range of rows,
+/// and the facts and derived literals of a conditional effect are contiguous ranges in shared arrays.
+/// Numeric constraints and numeric effects are compiled into a shared numeric bytecode.
+/// Applying an action is a linear scan over these arrays without resolving views through the repository.
+/// Conditional effects with a false static literal are dropped during compilation.
+class GroundActionTable
+{
+public:
+    GroundActionTable() = default;
+    GroundActionTable(formalism::planning::GroundActionListView actions, const boost::dynamic_bitset<>& static_atoms);
+
+    bool contains(Index<formalism::planning::GroundAction> action) const noexcept
+    {
+        return uint_t(action) < m_row_by_action.size() && m_row_by_action[uint_t(action)] != NO_ROW;
+    }
+
+    /// @brief Collect the effects of the given action that fire in the state, analogous to process_effects on a GroundActionView.
+    void apply(Index<formalism::planning::GroundAction> action,
+               StateContext<GroundTag>& state_context,
+               UnpackedState<GroundTag>& succ_unpacked_state,
+               DataList<formalism::planning::FDRFact<formalism::FluentTag>>& out_del_effects,
+               DataList<formalism::planning::FDRFact<formalism::FluentTag>>& out_add_effects) const;
+
+    size_t memory_usage() const noexcept;
+
+private:
+    static constexpr uint_t NO_ROW = std::numeric_limits<uint_t>::max();
+
+    /// Segments of the facts of a conditional effect in m_fact_variables and m_fact_values.
+    enum Segment : uint_t
+    {
+        POSITIVE_CONDITION = 0,
+        NEGATIVE_CONDITION = 1,
+        DEL_EFFECT = 2,
+        ADD_EFFECT = 3,
+        NUM_SEGMENTS = 4,
+    };
+
+    bool is_applicable(uint_t effect, const StateContext<GroundTag>& state_context) const;
+
+    std::vector<uint_t> m_row_by_action;
+    std::vector<uint_t> m_effect_offsets;  ///< conditional effects of row i are [m_effect_offsets[i], m_effect_offsets[i + 1])
+
+    // Per conditional effect.
+    std::vector<uint_t> m_fact_offsets;     ///< segment s of effect e begins at m_fact_offsets[NUM_SEGMENTS * e + s]
+    std::vector<uint_t> m_derived_offsets;  ///< derived literals of effect e are [m_derived_offsets[e], m_derived_offsets[e + 1])
+    std::vector<uint_t> m_constraint_offsets;      ///< numeric constraints of effect e are [m_constraint_offsets[e], m_constraint_offsets[e + 1])
+    std::vector<uint_t> m_numeric_effect_offsets;  ///< numeric effects of effect e are [m_numeric_effect_offsets[e], m_numeric_effect_offsets[e + 1])
+    std::vector<uint8_t> m_has_auxiliary_numeric_effect;
+    std::vector<formalism::NumericExpressionCode> m_auxiliary_numeric_effects;
+
+    // Per fact.
+    std::vector<Index<formalism::planning::FDRVariable<formalism::FluentTag>>> m_fact_variables;
+    std::vector<formalism::planning::FDRValue> m_fact_values;
+
+    // Per derived literal.
+    std::vector<Index<formalism::planning::GroundAtom<formalism::DerivedTag>>> m_derived_atoms;
+    std::vector<uint8_t> m_derived_polarities;
+
+    // Per numeric constraint.
+    std::vector<formalism::NumericConstraintCode> m_constraints;
+
+    // Per numeric effect.
+    std::vector<Index<formalism::planning::GroundFunctionTerm<formalism::FluentTag>>> m_numeric_effect_fterms;
+    std::vector<formalism::NumericExpressionCode> m_numeric_effect_values;
+
+    formalism::NumericBytecode m_bytecode;
+};
+
+}
+
+#endif
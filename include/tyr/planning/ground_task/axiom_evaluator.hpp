@@ -26,6 +26,10 @@
 #include "tyr/planning/ground_task/match_tree/declarations.hpp"
 #include "tyr/planning/ground_task/match_tree/match_tree.hpp"
 
+#include <boost/dynamic_bitset.hpp>
+#include <optional>
+#include <vector>
+
 namespace tyr::planning
 {
 template<>
@@ -39,9 +43,30 @@ public:
     void compute_extended_state(UnpackedState<GroundTag>& unpacked_state);
 
 private:
+    /// @brief A stratum whose axioms depend positively on derived atoms of the same stratum.
+    ///
+    /// The axioms are evaluated semi-naively: each axiom counts its recursive preconditions that are not yet true,
+    /// and an axiom fires as soon as its counter drops to zero and its remaining condition holds in the state.
+    struct RecursiveStratum
+    {
+        IndexList<formalism::planning::GroundAxiom> axioms;
+        std::vector<IndexList<formalism::planning::GroundLiteral<formalism::DerivedTag>>> base_derived_literals;  ///< non recursive derived literals
+        std::vector<uint_t> num_recursive_preconditions;
+        UnorderedMap<Index<formalism::planning::GroundAtom<formalism::DerivedTag>>, std::vector<uint_t>> axioms_by_recursive_atom;
+    };
+
+    bool is_base_applicable(const RecursiveStratum& stratum, uint_t axiom, const StateContext<GroundTag>& state_context) const;
+
+    void evaluate_recursive_stratum(const RecursiveStratum& stratum, UnpackedState<GroundTag>& unpacked_state);
+
     std::shared_ptr<Task<GroundTag>> m_task;
 
+    std::vector<std::optional<RecursiveStratum>> m_recursive_strata;  ///< std::nullopt for strata that are evaluated in a single match tree pass.
+
     IndexList<formalism::planning::GroundAxiom> m_applicable_axioms;
+    std::vector<uint_t> m_counters;
+    boost::dynamic_bitset<> m_is_base_applicable;
+    IndexList<formalism::planning::GroundAtom<formalism::DerivedTag>> m_queue;
 };
 }
 
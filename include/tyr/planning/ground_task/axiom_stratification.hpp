@@ -32,6 +32,8 @@ using GroundAxiomStratum = IndexList<formalism::planning::GroundAxiom>;
 struct GroundAxiomStrata
 {
     std::vector<GroundAxiomStratum> data;
+    /// @brief Whether an axiom of the stratum has a positive body literal over a head of the same stratum.
+    std::vector<bool> is_recursive;
 };
 
 /// @brief Compute the rule stratification for the rules in the given program.
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_GROUND_TASK_BITSET_MATCHER_HPP_
+#define TYR_PLANNING_GROUND_TASK_BITSET_MATCHER_HPP_
+
+#include "tyr/common/types.hpp"
+#include "tyr/formalism/numeric_bytecode.hpp"
+#include "tyr/formalism/planning/declarations.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace tyr::planning
+{
+
+/// @brief Generate the elements whose conditions hold in a state by intersecting bitsets over the elements.
+///
+/// For each value of each FDR variable and each truth value of each derived atom that occurs in a condition,
+/// the matcher stores the bitset of elements that are compatible with it.
+/// The applicable elements are the intersection of the bitsets selected by the state,
+/// followed by a residual check of the numeric constraints.
+/// Static literals are assumed to hold, which is guaranteed by the task grounder.
+template<typename Tag>
+class BitsetMatcher
+{
+public:
+    using Block = uint64_t;
+
+    BitsetMatcher(IndexList<Tag> elements, const formalism::planning::Repository& context);
+
+    static std::unique_ptr<BitsetMatcher<Tag>> create(IndexList<Tag> elements, const formalism::planning::Repository& context);
+
+    /// @brief Return true iff the blocks touched per state do not exceed the total number of preconditions
+    /// and the bitsets require at most a constant factor more memory than the preconditions themselves.
+    static bool is_preferred(const IndexList<Tag>& elements, const formalism::planning::Repository& context);
+
+    void generate(const StateContext<GroundTag>& state, IndexList<Tag>& out_applicable_elements);
+
+    size_t memory_usage() const noexcept { return m_blocks.capacity() * sizeof(Block); }
+
+private:
+    IndexList<Tag> m_elements;
+
+    const formalism::planning::Repository& m_context;
+
+    size_t m_num_blocks;  ///< per bitset
+
+    std::vector<Block> m_blocks;  ///< all bitsets stored contiguously
+    std::vector<std::pair<Index<formalism::planning::FDRVariable<formalism::FluentTag>>, size_t>> m_variable_offsets;  ///< offset of value 0
+    std::vector<std::pair<Index<formalism::planning::GroundAtom<formalism::DerivedTag>>, size_t>> m_derived_offsets;   ///< offset of false
+    std::vector<Block> m_constrained;  ///< bitset of elements with numeric constraints
+
+    std::vector<uint_t> m_constraint_offsets;  ///< numeric constraints of the element at position i are [m_constraint_offsets[i], m_constraint_offsets[i + 1])
+    std::vector<formalism::NumericConstraintCode> m_constraints;
+    formalism::NumericBytecode m_bytecode;
+
+    std::vector<Block> m_applicable;  ///< temporary during evaluation.
+};
+
+template<typename Tag>
+using BitsetMatcherPtr = std::unique_ptr<BitsetMatcher<Tag>>;
+
+}
+
+#endif
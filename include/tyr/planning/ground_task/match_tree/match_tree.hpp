@@ -19,6 +19,7 @@
 #define TYR_PLANNING_GROUND_TASK_MATCH_TREE_MATCH_TREE_HPP_
 
 #include "tyr/common/types.hpp"
+#include "tyr/formalism/numeric_bytecode.hpp"
 #include "tyr/formalism/planning/declarations.hpp"
 #include "tyr/formalism/planning/repository.hpp"
 #include "tyr/planning/declarations.hpp"
@@ -43,6 +44,9 @@ private:
 
     std::vector<Data<Node<Tag>>> m_evaluate_stack;  ///< temporary during evaluation.
 
+    formalism::NumericBytecode m_bytecode;
+    std::vector<formalism::NumericConstraintCode> m_constraint_codes;  ///< indexed by constraint node, compiled during construction.
+
 public:
     MatchTree(IndexList<Tag> elements, const formalism::planning::Repository& context);
     ~MatchTree();
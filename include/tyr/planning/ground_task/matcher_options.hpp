@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_GROUND_TASK_MATCHER_OPTIONS_HPP_
+#define TYR_PLANNING_GROUND_TASK_MATCHER_OPTIONS_HPP_
+
+namespace tyr::planning
+{
+
+/// @brief Selection of the data structure that generates the applicable ground actions of a state.
+enum class ActionMatcherKind
+{
+    MATCH_TREE,
+    BITSET,
+    /// @brief Choose BITSET if its estimated work per state does not exceed the total number of preconditions.
+    AUTOMATIC,
+};
+
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include "tyr/planning/state_index.hpp"
 #include "tyr/planning/state_repository.hpp"
 #include "tyr/planning/state_storage/config.hpp"
+#include "tyr/planning/state_storage/options.hpp"
 
 #if defined(TYR_STATE_STORAGE_HASHSET)
 #include "tyr/planning/ground_task/state_storage/hash_set/atom.hpp"
@@ -38,6 +39,10 @@
 #include "tyr/planning/ground_task/state_storage/tree_compression/atom.hpp"
 #include "tyr/planning/ground_task/state_storage/tree_compression/fact.hpp"
 #include "tyr/planning/state_storage/tree_compression/numeric.hpp"
+#elif defined(TYR_STATE_STORAGE_DYNAMIC)
+#include "tyr/planning/state_storage/dynamic/atom.hpp"
+#include "tyr/planning/state_storage/dynamic/fact.hpp"
+#include "tyr/planning/state_storage/dynamic/numeric.hpp"
 #endif
 
 #include <memory>
@@ -51,9 +56,12 @@ template<>
 class StateRepository<GroundTag> : public std::enable_shared_from_this<StateRepository<GroundTag>>
 {
 public:
-    explicit StateRepository(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context);
+    explicit StateRepository(std::shared_ptr<Task<GroundTag>> task,
+                             ExecutionContextPtr execution_context,
+                             StateStorageOptions storage_options = StateStorageOptions());
 
-    static std::shared_ptr<StateRepository<GroundTag>> create(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context);
+    static std::shared_ptr<StateRepository<GroundTag>>
+    create(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context, StateStorageOptions storage_options = StateStorageOptions());
 
     StateView<GroundTag> get_initial_state();
 
@@ -78,6 +86,11 @@ public:
     size_t num_states() const noexcept { return m_packed_states.size(); }
 
 private:
+#if defined(TYR_STATE_STORAGE_DYNAMIC)
+    /// @brief Re-insert all registered states into the tree compression backend, preserving their indices.
+    void migrate_state_storage();
+#endif
+
     std::shared_ptr<Task<GroundTag>> m_task;
 
     StateStorageContext<GroundTag, StateStoragePolicyTag> m_context;
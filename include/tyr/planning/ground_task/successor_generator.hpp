@@ -25,6 +25,7 @@
 #include "tyr/formalism/planning/ground_action_view.hpp"
 #include "tyr/planning/action_executor.hpp"
 #include "tyr/planning/declarations.hpp"
+#include "tyr/planning/state_storage/options.hpp"
 #include "tyr/planning/successor_generator.hpp"
 
 namespace tyr::planning
@@ -34,15 +35,21 @@ template<>
 class SuccessorGenerator<GroundTag>
 {
 public:
-    explicit SuccessorGenerator(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context);
+    explicit SuccessorGenerator(std::shared_ptr<Task<GroundTag>> task,
+                                ExecutionContextPtr execution_context,
+                                StateStorageOptions storage_options = StateStorageOptions());
 
-    static std::shared_ptr<SuccessorGenerator<GroundTag>> create(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context);
+    static std::shared_ptr<SuccessorGenerator<GroundTag>>
+    create(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context, StateStorageOptions storage_options = StateStorageOptions());
 
     Node<GroundTag> get_initial_node();
 
     std::vector<LabeledNode<GroundTag>> get_labeled_successor_nodes(const Node<GroundTag>& node);
     void get_labeled_successor_nodes(const Node<GroundTag>& node, std::vector<LabeledNode<GroundTag>>& out_nodes);
 
+    /// @brief Get the applicable actions without generating the successor nodes.
+    void get_applicable_actions(const Node<GroundTag>& node, std::vector<formalism::planning::GroundActionView>& out_actions);
+
     Node<GroundTag> get_successor_node(const Node<GroundTag>& node, formalism::planning::GroundActionView action);
 
     Node<GroundTag> get_node(Index<State<GroundTag>> state_index);
@@ -50,6 +57,9 @@ public:
     const auto& get_state_repository() const noexcept { return m_state_repository; }
 
 private:
+    /// @brief Fill m_applicable_actions with the actions that the action match tree or the action bitset matcher of the task generates.
+    void generate_applicable_actions(const StateContext<GroundTag>& state_context);
+
     std::shared_ptr<Task<GroundTag>> m_task;
 
     IndexList<formalism::planning::GroundAction> m_applicable_actions;
@@ -24,10 +24,14 @@
 #include "tyr/common/hash.hpp"
 #include "tyr/formalism/planning/declarations.hpp"
 #include "tyr/formalism/planning/ground_action_index.hpp"
+#include "tyr/formalism/planning/ground_action_view.hpp"
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/ground_task/state_view.hpp"
 #include "tyr/planning/lifted_task/state_view.hpp"
 
+#include <cassert>
+#include <span>
+
 namespace tyr::planning
 {
 
@@ -41,6 +45,29 @@ public:
 
     virtual float_t evaluate(const StateView<Kind>& state) = 0;
 
+    /// @brief Evaluate a batch of states, e.g., the successors of an expansion, writing one value per state.
+    ///
+    /// Heuristics that can amortize work across states override this; the default evaluates one state at a time.
+    virtual void evaluate_batch(std::span<const StateView<Kind>* const> states, std::span<float_t> out_values)
+    {
+        assert(states.size() == out_values.size());
+
+        for (size_t i = 0; i < states.size(); ++i)
+            out_values[i] = evaluate(*states[i]);
+    }
+
+    /// @brief Whether evaluate_successor is cheaper than evaluating the successor from scratch.
+    virtual bool has_incremental_evaluation() const noexcept { return false; }
+
+    /// @brief Evaluate the successor `succ_state` obtained by applying `action` in `state` with heuristic value `value`.
+    ///
+    /// Incremental heuristics update the value from the effects of the action; the default evaluates the successor from scratch.
+    virtual float_t
+    evaluate_successor(const StateView<Kind>& state, float_t value, formalism::planning::GroundActionView action, const StateView<Kind>& succ_state)
+    {
+        return evaluate(succ_state);
+    }
+
     virtual const UnorderedSet<Index<formalism::planning::GroundAction>>& get_preferred_actions()
     {
         static const auto actions = UnorderedSet<Index<formalism::planning::GroundAction>> {};
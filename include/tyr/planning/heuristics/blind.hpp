@@ -21,11 +21,14 @@
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/heuristic.hpp"
 
+#include <algorithm>
+#include <span>
+
 namespace tyr::planning
 {
 
 template<TaskKind Kind>
-class BlindHeuristic : public Heuristic<Kind>
+class BlindHeuristic final : public Heuristic<Kind>
 {
 public:
     BlindHeuristic() = default;
@@ -35,6 +38,11 @@ public:
     void set_goal(formalism::planning::GroundConjunctiveConditionView goal) override {}
 
     float_t evaluate(const StateView<Kind>& state) override { return float_t { 0 }; }
+
+    void evaluate_batch(std::span<const StateView<Kind>* const> states, std::span<float_t> out_values) override
+    {
+        std::fill(out_values.begin(), out_values.end(), float_t { 0 });
+    }
 };
 
 }
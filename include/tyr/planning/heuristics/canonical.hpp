@@ -18,8 +18,10 @@
 #ifndef TYR_PLANNING_HEURISTICS_CANONICAL_HPP_
 #define TYR_PLANNING_HEURISTICS_CANONICAL_HPP_
 
+#include "tyr/planning/abstractions/distance_table.hpp"
 #include "tyr/planning/abstractions/explicit_projection.hpp"
 #include "tyr/planning/heuristic.hpp"
+#include "tyr/planning/heuristics/projection_abstraction.hpp"
 
 #include <memory>
 #include <vector>
@@ -27,12 +29,32 @@
 namespace tyr::planning
 {
 
+/// @brief Return true iff no ground action matches a label of both projections, such that the sum of their estimates is admissible.
+template<TaskKind Kind>
+bool are_additive(const ProjectionAbstraction<Kind>& lhs, const ProjectionAbstraction<Kind>& rhs);
+
+/// @brief Compute the maximal additive subsets of the projections as lists of their indices.
+template<TaskKind Kind>
+std::vector<std::vector<uint_t>> compute_maximal_additive_subsets(const ProjectionAbstractionList<Kind>& projections);
+
+/// @brief The maximum over the maximal additive subsets of the projections of the sum of their estimates.
+///
+/// Projections onto the same pattern share a component, such that each component is evaluated once per state.
+/// Cliques that are dominated by another clique are pruned at construction.
 template<TaskKind Kind>
 class CanonicalHeuristic : public Heuristic<Kind>
 {
 private:
-    std::vector<std::shared_ptr<Heuristic<Kind>>> m_components;
-    std::vector<std::vector<uint_t>> m_additive_partitions;
+    std::vector<std::shared_ptr<ProjectionAbstractionHeuristic<Kind>>> m_components;
+
+    // The components of clique c are m_clique_components[m_clique_offsets[c]..m_clique_offsets[c + 1]).
+    std::vector<uint_t> m_clique_offsets;
+    std::vector<uint_t> m_clique_components;
+
+    // The distance tables of the components and the buffers for looking up all components at once.
+    std::vector<const DistanceTable*> m_tables;
+    std::vector<uint_t> m_abstract_states;
+    std::vector<float_t> m_values;
 
 public:
     explicit CanonicalHeuristic(const ProjectionAbstractionList<Kind>& projections);
@@ -40,6 +62,9 @@ public:
     static std::shared_ptr<CanonicalHeuristic<Kind>> create(const ProjectionAbstractionList<Kind>& projections);
 
     float_t evaluate(const StateView<Kind>& state) override;
+
+    size_t num_components() const noexcept { return m_components.size(); }
+    size_t num_cliques() const noexcept { return m_clique_offsets.size() - 1; }
 };
 
 }
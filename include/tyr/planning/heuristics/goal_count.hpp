@@ -21,11 +21,14 @@
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/heuristic.hpp"
 
+#include <utility>
+#include <vector>
+
 namespace tyr::planning
 {
 
 template<TaskKind Kind>
-class GoalCountHeuristic : public Heuristic<Kind>
+class GoalCountHeuristic final : public Heuristic<Kind>
 {
 public:
     explicit GoalCountHeuristic(std::shared_ptr<const Task<Kind>> task);
@@ -36,10 +39,26 @@ public:
 
     float_t evaluate(const StateView<Kind>& state) override;
 
-protected:
+    /// @brief Incremental if the goal consists of facts only: derived literals and numeric constraints can change without a fact effect.
+    bool has_incremental_evaluation() const noexcept override { return m_incremental; }
+
+    float_t evaluate_successor(const StateView<Kind>& state,
+                               float_t value,
+                               formalism::planning::GroundActionView action,
+                               const StateView<Kind>& succ_state) override;
+
+private:
+    void index_goal_facts();
+
     std::shared_ptr<const Task<Kind>> m_task;
 
     formalism::planning::GroundConjunctiveConditionView m_goal;
+
+    bool m_incremental;
+    UnorderedMap<Index<formalism::planning::FDRVariable<formalism::FluentTag>>,
+                 std::vector<std::pair<formalism::planning::FDRFactView<formalism::FluentTag>, bool>>>
+        m_goal_facts_by_variable;  ///< goal facts with their polarity
+    std::vector<Index<formalism::planning::FDRVariable<formalism::FluentTag>>> m_touched_variables;
 };
 
 }
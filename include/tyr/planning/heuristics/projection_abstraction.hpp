@@ -18,10 +18,13 @@
 #ifndef TYR_PLANNING_HEURISTICS_PROJECTION_ABSTRACTION_HPP_
 #define TYR_PLANNING_HEURISTICS_PROJECTION_ABSTRACTION_HPP_
 
+#include "tyr/planning/abstractions/distance_table.hpp"
 #include "tyr/planning/abstractions/explicit_projection.hpp"
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/heuristic.hpp"
 
+#include <memory>
+
 namespace tyr::planning
 {
 
@@ -35,9 +38,24 @@ public:
 
     float_t evaluate(const StateView<Kind>& state) override;
 
+    bool has_incremental_evaluation() const noexcept override { return true; }
+
+    float_t evaluate_successor(const StateView<Kind>& state,
+                               float_t value,
+                               formalism::planning::GroundActionView action,
+                               const StateView<Kind>& succ_state) override;
+
+    const auto& get_distances() const noexcept { return *m_distances; }
+    const auto& get_mapping() const noexcept { return m_mapping; }
+
 private:
-    std::vector<float_t> m_distances;
+    std::shared_ptr<const DistanceTable> m_distances;  ///< shared with the projection
     ProjectionMapping<Kind> m_mapping;
+
+    // The abstract state of the last parent, since the successors of a state are usually evaluated in sequence.
+    const StateRepository<Kind>* m_cached_state_repository;
+    Index<State<Kind>> m_cached_state;
+    uint_t m_cached_abstract_state;
 };
 
 }
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_HEURISTICS_SATURATED_COST_PARTITIONING_HPP_
+#define TYR_PLANNING_HEURISTICS_SATURATED_COST_PARTITIONING_HPP_
+
+#include "tyr/planning/abstractions/distance_table.hpp"
+#include "tyr/planning/abstractions/explicit_projection.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/heuristic.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace tyr::planning
+{
+
+struct SaturatedCostPartitioningOptions
+{
+    /// @brief The maximum number of orders, including the given order of the projections.
+    uint_t max_orders = 50;
+    uint_t random_seed = 0;
+};
+
+/// @brief The maximum over saturated cost partitionings of the projections for several orders.
+///
+/// For each order, the projections are considered in sequence: the goal distances of a projection are computed under the remaining costs,
+/// and the saturated costs, i.e., the minimum costs that preserve these distances, are subtracted before the next projection.
+/// The estimate of an order is the sum over its projections, and the heuristic value is the maximum over the orders.
+///
+/// Costs are partitioned over classes of transition labels: labels of different projections that can represent a common ground action,
+/// i.e., that have the same original action and compatible substitutions, share a class. Labels that cannot match a common ground action,
+/// such as the labels of an action schema on different objects, keep separate costs. The cost of a class is the smallest cost of its labels.
+///
+/// The first order is the given order of the projections, and the others are random permutations. If sample states are given,
+/// an order is only kept if it increases the maximum over the kept orders on some sample.
+template<TaskKind Kind>
+class SaturatedCostPartitioningHeuristic : public Heuristic<Kind>
+{
+public:
+    explicit SaturatedCostPartitioningHeuristic(const ProjectionAbstractionList<Kind>& projections,
+                                                const std::vector<StateView<Kind>>& samples = {},
+                                                SaturatedCostPartitioningOptions options = SaturatedCostPartitioningOptions());
+
+    static std::shared_ptr<SaturatedCostPartitioningHeuristic<Kind>> create(const ProjectionAbstractionList<Kind>& projections,
+                                                                            const std::vector<StateView<Kind>>& samples = {},
+                                                                            SaturatedCostPartitioningOptions options = SaturatedCostPartitioningOptions());
+
+    // The lookup buffer points into the tables.
+    SaturatedCostPartitioningHeuristic(const SaturatedCostPartitioningHeuristic& other) = delete;
+    SaturatedCostPartitioningHeuristic& operator=(const SaturatedCostPartitioningHeuristic& other) = delete;
+
+    float_t evaluate(const StateView<Kind>& state) override;
+
+    size_t num_orders() const noexcept { return m_mappings.empty() ? 0 : m_tables.size() / m_mappings.size(); }
+
+private:
+    std::vector<ProjectionMapping<Kind>> m_mappings;
+
+    // The distance tables of order o are at [o * k, (o + 1) * k) for k projections.
+    std::vector<DistanceTable> m_tables;
+
+    // The buffers for looking up all tables at once.
+    std::vector<const DistanceTable*> m_table_ptrs;
+    std::vector<uint_t> m_abstract_states;
+    std::vector<float_t> m_values;
+};
+
+}
+
+#endif
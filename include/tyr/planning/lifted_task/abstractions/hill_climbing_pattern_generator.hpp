@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_LIFTED_TASK_ABSTRACTIONS_HILL_CLIMBING_PATTERN_GENERATOR_HPP_
+#define TYR_PLANNING_LIFTED_TASK_ABSTRACTIONS_HILL_CLIMBING_PATTERN_GENERATOR_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/planning/abstractions/hill_climbing_pattern_generator.hpp"
+#include "tyr/planning/abstractions/pattern_generator.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/lifted_task.hpp"
+#include "tyr/planning/lifted_task/abstractions/projection_generator.hpp"
+
+#include <chrono>
+#include <memory>
+
+namespace tyr::planning
+{
+
+struct HillClimbingPatternGeneratorOptions
+{
+    /// @brief The time after which the current collection is returned.
+    std::chrono::milliseconds max_time = std::chrono::seconds(100);
+    /// @brief The maximum number of abstract states of a single pattern.
+    uint_t max_pdb_size = 1024;
+    /// @brief The maximum number of abstract states summed over all patterns of the collection.
+    uint_t max_collection_size = 16384;
+    /// @brief The number of states sampled by random walks in each iteration to evaluate the candidates.
+    uint_t num_samples = 100;
+    /// @brief The minimum number of samples on which the best candidate must increase the heuristic value.
+    uint_t min_improvement = 1;
+    uint_t random_seed = 0;
+
+    /// @brief The options for generating the projections of the candidates.
+    ProjectionGeneratorOptions projection_options = ProjectionGeneratorOptions();
+};
+
+/// @brief Generate a pattern collection by hill climbing in the space of pattern collections (iPDB).
+///
+/// The search starts from one pattern per goal atom. In each iteration, every pattern is extended by each candidate atom
+/// whose predicate is a predecessor of a predicate of the pattern in the predicate-level causal graph and that shares an object
+/// with the pattern, or is nullary. The candidate atoms are the atoms of the initial state, the goal, and the sampled states,
+/// such that atoms that only hold in the middle of a plan are candidates once a random walk reaches them. The candidate that increases
+/// the canonical heuristic on the most sampled states is added to the collection, until no candidate improves
+/// on enough samples or a budget is exhausted. The candidates are evaluated incrementally on the maximal additive subsets of the collection.
+template<>
+class HillClimbingPatternGenerator<LiftedTag> : public PatternGenerator<LiftedTag>
+{
+public:
+    HillClimbingPatternGenerator(std::shared_ptr<Task<LiftedTag>> task, HillClimbingPatternGeneratorOptions options = HillClimbingPatternGeneratorOptions());
+
+    static std::shared_ptr<HillClimbingPatternGenerator<LiftedTag>>
+    create(std::shared_ptr<Task<LiftedTag>> task, HillClimbingPatternGeneratorOptions options = HillClimbingPatternGeneratorOptions());
+
+    PatternCollection generate() override;
+
+private:
+    std::shared_ptr<Task<LiftedTag>> m_task;
+    HillClimbingPatternGeneratorOptions m_options;
+};
+
+}
+
+#endif
@@ -28,23 +28,48 @@
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/lifted_task.hpp"
 
+#include <filesystem>
+#include <optional>
+#include <vector>
+
 namespace f = tyr::formalism;
 namespace fp = tyr::formalism::planning;
 
 namespace tyr::planning
 {
 
+struct ProjectionGeneratorOptions
+{
+    /// @brief Pairwise disjoint sets of pairwise mutex atoms of the task that reduce the abstract state spaces, see ProjectionMapping.
+    std::vector<fp::GroundAtomViewList<f::FluentTag>> mutex_groups = {};
+
+    /// @brief The directory in which projections are stored and from which they are reused across runs, or none to always generate them.
+    std::optional<std::filesystem::path> cache_directory = std::nullopt;
+};
+
+struct ProjectionGeneratorStatistics
+{
+    /// @brief The number of projections that were loaded from the cache directory.
+    uint_t num_loaded_projections = 0;
+    /// @brief The number of projections that were generated and written to the cache directory.
+    uint_t num_stored_projections = 0;
+};
+
 template<>
 class ProjectionGenerator<LiftedTag>
 {
 public:
-    ProjectionGenerator(std::shared_ptr<const Task<LiftedTag>> task, PatternCollection patterns);
+    ProjectionGenerator(std::shared_ptr<const Task<LiftedTag>> task, PatternCollection patterns, ProjectionGeneratorOptions options = ProjectionGeneratorOptions());
 
     ProjectionAbstractionList<LiftedTag> generate();
 
+    const ProjectionGeneratorStatistics& get_statistics() const noexcept { return m_statistics; }
+
 private:
     std::shared_ptr<const Task<LiftedTag>> m_task;
     PatternCollection m_patterns;
+    ProjectionGeneratorOptions m_options;
+    ProjectionGeneratorStatistics m_statistics;
 };
 
 }
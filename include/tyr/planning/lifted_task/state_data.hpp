@@ -34,6 +34,10 @@
 #include "tyr/planning/lifted_task/state_storage/tree_compression/atom.hpp"
 #include "tyr/planning/lifted_task/state_storage/tree_compression/fact.hpp"
 #include "tyr/planning/state_storage/tree_compression/numeric.hpp"
+#elif defined(TYR_STATE_STORAGE_DYNAMIC)
+#include "tyr/planning/state_storage/dynamic/atom.hpp"
+#include "tyr/planning/state_storage/dynamic/fact.hpp"
+#include "tyr/planning/state_storage/dynamic/numeric.hpp"
 #endif
 
 #include <valla/valla.hpp>
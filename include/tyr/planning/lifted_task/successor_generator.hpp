@@ -32,6 +32,8 @@
 #include "tyr/planning/lifted_task/node.hpp"
 #include "tyr/planning/lifted_task/state_repository.hpp"
 #include "tyr/planning/lifted_task/state_view.hpp"
+#include "tyr/planning/state_handle.hpp"
+#include "tyr/planning/state_storage/options.hpp"
 #include "tyr/planning/successor_generator.hpp"
 
 #include <type_traits>
@@ -44,9 +46,12 @@ template<>
 class SuccessorGenerator<LiftedTag>
 {
 public:
-    explicit SuccessorGenerator(std::shared_ptr<Task<LiftedTag>> task, ExecutionContextPtr execution_context);
+    explicit SuccessorGenerator(std::shared_ptr<Task<LiftedTag>> task,
+                                ExecutionContextPtr execution_context,
+                                StateStorageOptions storage_options = StateStorageOptions());
 
-    static std::shared_ptr<SuccessorGenerator<LiftedTag>> create(std::shared_ptr<Task<LiftedTag>> task, ExecutionContextPtr execution_context);
+    static std::shared_ptr<SuccessorGenerator<LiftedTag>>
+    create(std::shared_ptr<Task<LiftedTag>> task, ExecutionContextPtr execution_context, StateStorageOptions storage_options = StateStorageOptions());
 
     Node<LiftedTag> get_initial_node();
 
@@ -55,6 +60,9 @@ public:
 
     void get_labeled_successor_nodes(const Node<LiftedTag>& node, std::vector<LabeledNode<LiftedTag>>& out_nodes);
 
+    /// @brief Get the applicable ground actions without generating the successor nodes.
+    void get_applicable_actions(const Node<LiftedTag>& node, std::vector<formalism::planning::GroundActionView>& out_actions);
+
     Node<LiftedTag> get_successor_node(const Node<LiftedTag>& node, formalism::planning::GroundActionView action);
 
     // Action binding API (interning)
@@ -85,7 +93,7 @@ public:
     const auto& get_workspace() const noexcept { return m_workspace; }
 
 private:
-    void compute_action_facts(const Node<LiftedTag>& node);
+    void compute_action_facts(StateHandle<LiftedTag> state);
 
     using ActionBindingCallback = void (*)(const Data<formalism::RelationBinding<formalism::planning::Action>>&, void*);
 
@@ -20,6 +20,10 @@
 
 #include "tyr/common/onetbb.hpp"
 #include "tyr/planning/declarations.hpp"
+#include "tyr/planning/ground_task/matcher_options.hpp"
+
+#include <chrono>
+#include <optional>
 
 namespace tyr::planning
 {
@@ -39,6 +43,9 @@ struct GroundTaskInstantiationResult
 struct GroundTaskInstantiationOptions
 {
     bool disable_invariant_synthesis = false;
+    std::optional<std::chrono::steady_clock::duration> max_invariant_synthesis_time = std::nullopt;
+    bool enable_relevance_analysis = false;  ///< prune actions, axioms, and FDR variables that are irrelevant for reaching the goal.
+    ActionMatcherKind action_matcher = ActionMatcherKind::AUTOMATIC;
 };
 
 }
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_NOVELTY_HPP_
+#define TYR_PLANNING_NOVELTY_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <boost/dynamic_bitset.hpp>
+#include <vector>
+
+namespace tyr::planning
+{
+
+/// @brief Tables of the atoms and atom pairs seen in previous states, used to compute the novelty of a state.
+///
+/// The atoms of a state are its fluent facts with a value other than none. They are identified by a dense
+/// fact index: for ground tasks, the offset of the FDR variable plus its value, and for lifted tasks,
+/// the index of the interned ground atom. Pairs are stored in a lower triangular bitset that is stable
+/// under appending atoms, such that the tables can grow with the atoms of a lifted task.
+template<TaskKind Kind>
+class NoveltyTable
+{
+public:
+    /// @param arity is the size of the largest tuple that is tracked, i.e., 1 or 2.
+    NoveltyTable(const Task<Kind>& task, uint_t arity);
+
+    /// @brief Compute the size of the smallest tuple of atoms of the state that was not seen before,
+    /// or arity + 1 if there is no such tuple, and mark all tuples of the state as seen.
+    uint_t compute_novelty_and_insert(const StateView<Kind>& state);
+
+    void clear();
+
+    uint_t get_arity() const noexcept { return m_arity; }
+    size_t memory_usage() const noexcept;
+
+private:
+    void compute_atoms(const StateView<Kind>& state);
+    void resize(uint_t num_atoms);
+
+    static size_t get_pair_index(uint_t lo, uint_t hi) noexcept { return size_t(hi) * (hi - 1) / 2 + lo; }
+
+    uint_t m_arity;
+    std::vector<uint_t> m_variable_offsets;  ///< only for ground tasks
+
+    uint_t m_num_atoms;
+    boost::dynamic_bitset<> m_seen_atoms;
+    boost::dynamic_bitset<> m_seen_pairs;
+
+    std::vector<uint_t> m_atoms;  ///< the atoms of the current state, sorted
+};
+
+}
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_NUMERIC_BYTECODE_HPP_
+#define TYR_PLANNING_NUMERIC_BYTECODE_HPP_
+
+#include "tyr/formalism/numeric_bytecode.hpp"
+#include "tyr/formalism/planning/declarations.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/formalism/planning/views.hpp"
+#include "tyr/planning/applicability_decl.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <type_traits>
+
+namespace tyr::planning
+{
+
+/**
+ * Compilation of ground expressions: function terms are resolved to their indices.
+ */
+
+struct EmitGroundLoad
+{
+    template<formalism::FactKind T>
+    void operator()(formalism::NumericBytecode& bytecode, formalism::planning::GroundFunctionTermView<T> element) const
+    {
+        if constexpr (std::is_same_v<T, formalism::StaticTag>)
+            bytecode.emit_load(formalism::NumericOpCode::LOAD_STATIC, uint_t(element.get_index()));
+        else if constexpr (std::is_same_v<T, formalism::FluentTag>)
+            bytecode.emit_load(formalism::NumericOpCode::LOAD_FLUENT, uint_t(element.get_index()));
+        else
+            bytecode.emit_load(formalism::NumericOpCode::LOAD_AUXILIARY);
+    }
+};
+
+inline formalism::NumericExpressionCode compile(formalism::planning::GroundFunctionExpressionView element, formalism::NumericBytecode& bytecode)
+{
+    return formalism::compile_expression(element, bytecode, EmitGroundLoad {});
+}
+
+inline formalism::NumericConstraintCode compile(formalism::planning::GroundBooleanOperatorView element, formalism::NumericBytecode& bytecode)
+{
+    return formalism::compile_constraint(element, bytecode, EmitGroundLoad {});
+}
+
+/// @brief Compile the value that the numeric effect assigns to its function term.
+template<formalism::planning::NumericEffectOpKind Op, formalism::FactKind T>
+formalism::NumericExpressionCode compile(formalism::planning::GroundNumericEffectView<Op, T> element, formalism::NumericBytecode& bytecode)
+{
+    bytecode.begin_expression();
+
+    if constexpr (!std::is_same_v<Op, formalism::planning::OpAssign>)
+        EmitGroundLoad {}(bytecode, element.get_fterm());
+
+    formalism::emit_expression(element.get_fexpr(), bytecode, EmitGroundLoad {});
+
+    if constexpr (std::is_same_v<Op, formalism::planning::OpIncrease>)
+        bytecode.emit_operator(formalism::NumericOpCode::ADD);
+    else if constexpr (std::is_same_v<Op, formalism::planning::OpDecrease>)
+        bytecode.emit_operator(formalism::NumericOpCode::SUB);
+    else if constexpr (std::is_same_v<Op, formalism::planning::OpScaleUp>)
+        bytecode.emit_operator(formalism::NumericOpCode::MUL);
+    else if constexpr (std::is_same_v<Op, formalism::planning::OpScaleDown>)
+        bytecode.emit_operator(formalism::NumericOpCode::DIV);
+
+    return bytecode.end_expression();
+}
+
+template<formalism::FactKind T>
+formalism::NumericExpressionCode compile(formalism::planning::GroundNumericEffectOperatorView<T> element, formalism::NumericBytecode& bytecode)
+{
+    return visit([&](auto&& arg) { return compile(arg, bytecode); }, element.get_variant());
+}
+
+/**
+ * Evaluation in a state.
+ */
+
+template<TaskKind Kind>
+struct StateLoad
+{
+    const StateContext<Kind>& context;
+
+    float_t operator()(const formalism::NumericInstruction& instruction) const
+    {
+        switch (instruction.opcode)
+        {
+            case formalism::NumericOpCode::LOAD_STATIC:
+                return context.task.get(Index<formalism::planning::GroundFunctionTerm<formalism::StaticTag>>(instruction.arg));
+            case formalism::NumericOpCode::LOAD_FLUENT:
+                return context.unpacked_state.get(Index<formalism::planning::GroundFunctionTerm<formalism::FluentTag>>(instruction.arg));
+            default:
+                return context.auxiliary_value;
+        }
+    }
+};
+
+template<TaskKind Kind>
+float_t evaluate(const formalism::NumericBytecode& bytecode, const formalism::NumericExpressionCode& expression, const StateContext<Kind>& context)
+{
+    return formalism::evaluate<float_t>(bytecode, expression, StateLoad<Kind> { context });
+}
+
+template<TaskKind Kind>
+bool is_applicable(const formalism::NumericBytecode& bytecode, const formalism::NumericConstraintCode& constraint, const StateContext<Kind>& context)
+{
+    return formalism::evaluate(bytecode, constraint, StateLoad<Kind> { context });
+}
+
+}
+
+#endif
@@ -18,19 +18,25 @@
 #ifndef TYR_PLANNING_PLANNING_HPP_
 #define TYR_PLANNING_PLANNING_HPP_
 
+#include "tyr/planning/abstractions/distance_table.hpp"
 #include "tyr/planning/abstractions/goal_pattern_generator.hpp"
+#include "tyr/planning/abstractions/hill_climbing_pattern_generator.hpp"
 #include "tyr/planning/abstractions/pattern_generator.hpp"
 #include "tyr/planning/algorithms/astar_eager.hpp"
 #include "tyr/planning/algorithms/astar_eager/event_handler.hpp"
+#include "tyr/planning/algorithms/bfws.hpp"
 #include "tyr/planning/algorithms/gbfs_lazy.hpp"
 #include "tyr/planning/algorithms/gbfs_lazy/event_handler.hpp"
+#include "tyr/planning/algorithms/iw.hpp"
 #include "tyr/planning/algorithms/statistics.hpp"
 #include "tyr/planning/algorithms/strategies/goal.hpp"
 #include "tyr/planning/algorithms/strategies/pruning.hpp"
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/formatter.hpp"
 #include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/ground_task/action_table.hpp"
 #include "tyr/planning/ground_task/axiom_evaluator.hpp"
+#include "tyr/planning/ground_task/bitset_matcher.hpp"
 #include "tyr/planning/ground_task/node.hpp"
 #include "tyr/planning/ground_task/state_data.hpp"
 #include "tyr/planning/ground_task/state_iterators.hpp"
@@ -43,7 +49,9 @@
 #include "tyr/planning/heuristics/goal_count.hpp"
 #include "tyr/planning/heuristics/max.hpp"
 #include "tyr/planning/heuristics/projection_abstraction.hpp"
+#include "tyr/planning/heuristics/saturated_cost_partitioning.hpp"
 #include "tyr/planning/lifted_task.hpp"
+#include "tyr/planning/lifted_task/abstractions/hill_climbing_pattern_generator.hpp"
 #include "tyr/planning/lifted_task/abstractions/projection_generator.hpp"
 #include "tyr/planning/lifted_task/axiom_evaluator.hpp"
 #include "tyr/planning/lifted_task/heuristics/rpg_add.hpp"
@@ -56,6 +64,7 @@
 #include "tyr/planning/lifted_task/state_view.hpp"
 #include "tyr/planning/lifted_task/successor_generator.hpp"
 #include "tyr/planning/lifted_task/unpacked_state.hpp"
+#include "tyr/planning/novelty.hpp"
 #include "tyr/planning/plan.hpp"
 #include "tyr/planning/programs/action.hpp"
 #include "tyr/planning/programs/axiom.hpp"
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_STATE_HANDLE_HPP_
+#define TYR_PLANNING_STATE_HANDLE_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/formalism/planning/declarations.hpp"
+#include "tyr/formalism/planning/fdr_value.hpp"
+#include "tyr/planning/applicability_decl.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/state_index.hpp"
+#include "tyr/planning/state_view.hpp"
+
+#include <type_traits>
+
+namespace tyr::planning
+{
+
+/// @brief A borrowed, trivially copyable handle to a state.
+///
+/// Unlike a StateView, the handle owns neither the state repository nor the unpacked state,
+/// such that copying it involves no reference counting. It must not outlive the StateView it borrows from.
+template<TaskKind Kind>
+class StateHandle
+{
+public:
+    using TaskType = Task<Kind>;
+
+    StateHandle(const Task<Kind>& task, const UnpackedState<Kind>& unpacked_state) noexcept : m_task(&task), m_unpacked_state(&unpacked_state) {}
+
+    StateHandle(const StateView<Kind>& state) noexcept : StateHandle(*state.get_state_repository()->get_task(), state.get_unpacked_state()) {}
+
+    Index<State<Kind>> get_index() const { return m_unpacked_state->get_index(); }
+
+    bool test(Index<formalism::planning::GroundAtom<formalism::StaticTag>> index) const { return m_task->test(index); }
+    float_t get(Index<formalism::planning::GroundFunctionTerm<formalism::StaticTag>> index) const { return m_task->get(index); }
+    formalism::planning::FDRValue get(Index<formalism::planning::FDRVariable<formalism::FluentTag>> index) const { return m_unpacked_state->get(index); }
+    float_t get(Index<formalism::planning::GroundFunctionTerm<formalism::FluentTag>> index) const { return m_unpacked_state->get(index); }
+    bool test(Index<formalism::planning::GroundAtom<formalism::DerivedTag>> index) const { return m_unpacked_state->test(index); }
+
+    /// @brief Get the context for applicability checks and action application in this state.
+    StateContext<Kind> get_context(float_t auxiliary_value = float_t { 0 }) const noexcept
+    {
+        return StateContext<Kind> { *m_task, *m_unpacked_state, auxiliary_value };
+    }
+
+    const Task<Kind>& get_task() const noexcept { return *m_task; }
+    const UnpackedState<Kind>& get_unpacked_state() const noexcept { return *m_unpacked_state; }
+
+private:
+    const Task<Kind>* m_task;
+    const UnpackedState<Kind>* m_unpacked_state;
+};
+
+static_assert(std::is_trivially_copyable_v<StateHandle<GroundTag>>);
+static_assert(std::is_trivially_copyable_v<StateHandle<LiftedTag>>);
+
+}
+
+#endif
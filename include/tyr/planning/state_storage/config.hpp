@@ -26,6 +26,8 @@ namespace tyr::planning
 using StateStoragePolicyTag = TreeCompression;
 #elif defined(TYR_STATE_STORAGE_HASHSET)
 using StateStoragePolicyTag = HashSet;
+#elif defined(TYR_STATE_STORAGE_DYNAMIC)
+using StateStoragePolicyTag = Dynamic;
 #else
 #error "No lifted state storage policy selected"
 #endif
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TYR_PLANNING_STATE_STORAGE_DYNAMIC_CONTEXT_HPP_
+#define TYR_PLANNING_STATE_STORAGE_DYNAMIC_CONTEXT_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/ground_task/state_storage/hash_set/atom.hpp"
+#include "tyr/planning/ground_task/state_storage/hash_set/fact.hpp"
+#include "tyr/planning/ground_task/state_storage/tree_compression/atom.hpp"
+#include "tyr/planning/ground_task/state_storage/tree_compression/fact.hpp"
+#include "tyr/planning/lifted_task/state_storage/hash_set/atom.hpp"
+#include "tyr/planning/lifted_task/state_storage/hash_set/fact.hpp"
+#include "tyr/planning/lifted_task/state_storage/tree_compression/atom.hpp"
+#include "tyr/planning/lifted_task/state_storage/tree_compression/fact.hpp"
+#include "tyr/planning/state_storage.hpp"
+#include "tyr/planning/state_storage/hash_set/numeric.hpp"
+#include "tyr/planning/state_storage/options.hpp"
+#include "tyr/planning/state_storage/tags.hpp"
+#include "tyr/planning/state_storage/tree_compression/numeric.hpp"
+
+#include <memory>
+#include <type_traits>
+#include <valla/valla.hpp>
+
+namespace tyr::planning
+{
+
+/**
+ * Backends
+ */
+
+/// @brief Owns a context together with the backends that operate on it.
+template<TaskKind Kind, typename Tag>
+struct StateStorageBackends
+{
+    template<typename... Args>
+    explicit StateStorageBackends(Args&&... args) :
+        context(std::forward<Args>(args)...),
+        fluent_backend(context),
+        derived_backend(context),
+        numeric_backend(context)
+    {
+    }
+
+    StateStorageContext<Kind, Tag> context;
+    FactStorageBackend<Kind, Tag> fluent_backend;
+    AtomStorageBackend<Kind, Tag> derived_backend;
+    NumericStorageBackend<Kind, Tag> numeric_backend;
+};
+
+/**
+ * Packed conversion
+ */
+
+/// @brief Packed storages of the dynamic policy are slots that can hold the packed storage of either backend.
+template<typename Packed>
+valla::Slot<uint_t> to_slot(const Packed& packed) noexcept
+{
+    auto slot = valla::Slot<uint_t>();
+    if constexpr (requires { packed.slot; })
+        slot = packed.slot;
+    else
+    {
+        slot.i1 = packed.index;
+        slot.i2 = 0;
+    }
+    return slot;
+}
+
+template<typename Packed>
+Packed from_slot(const valla::Slot<uint_t>& slot) noexcept
+{
+    auto packed = Packed();
+    if constexpr (requires { packed.slot; })
+        packed.slot = slot;
+    else
+        packed.index = slot.i1;
+    return packed;
+}
+
+/**
+ * Context
+ */
+
+template<TaskKind Kind>
+struct StateStorageContext<Kind, Dynamic>
+{
+    StateStorageContext(const Task<Kind>& task, StateStorageOptions options);
+
+    /// @brief True iff the tree compression backend is the active one.
+    bool is_tree_compression() const noexcept { return hash_set == nullptr; }
+
+    /// @brief True iff AUTOMATIC mode has exceeded its threshold and the registered states must be migrated.
+    bool requires_migration() const noexcept;
+
+    /// @brief Allocate the tree compression backend. Both backends are alive until `end_migration`.
+    void begin_migration();
+
+    /// @brief Release the hash set backend.
+    void end_migration();
+
+    size_t memory_usage() const noexcept;
+
+    const Task<Kind>& task;
+    StateStorageOptions options;
+
+    std::unique_ptr<StateStorageBackends<Kind, HashSet>> hash_set;
+    std::unique_ptr<StateStorageBackends<Kind, TreeCompression>> tree_compression;
+};
+
+}
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TYR_PLANNING_STATE_STORAGE_DYNAMIC_FACT_HPP_
+#define TYR_PLANNING_STATE_STORAGE_DYNAMIC_FACT_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/state_storage.hpp"
+#include "tyr/planning/state_storage/dynamic/context.hpp"
+#include "tyr/planning/state_storage/tags.hpp"
+
+#include <valla/valla.hpp>
+
+namespace tyr::planning
+{
+
+template<TaskKind Kind>
+struct FactPackedStorage<Kind, Dynamic>
+{
+    valla::Slot<uint_t> slot;
+
+    auto identifying_members() const noexcept { return std::tie(slot.i1, slot.i2); }
+};
+
+template<TaskKind Kind>
+class FactStorageBackend<Kind, Dynamic>
+{
+public:
+    using Unpacked = FactUnpackedStorage<Kind>;
+    using Packed = FactPackedStorage<Kind, Dynamic>;
+
+    explicit FactStorageBackend(StateStorageContext<Kind, Dynamic>& ctx);
+
+    Packed insert(const Unpacked& unpacked);
+
+    void unpack(const Packed& packed, Unpacked& unpacked);
+
+    /// @brief Re-insert a packed storage of the hash set backend into the tree compression backend.
+    Packed migrate(const Packed& packed, Unpacked& buffer);
+
+private:
+    StateStorageContext<Kind, Dynamic>& m_ctx;
+};
+
+}
+
+#endif
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TYR_PLANNING_STATE_STORAGE_OPTIONS_HPP_
+#define TYR_PLANNING_STATE_STORAGE_OPTIONS_HPP_
+
+#include <cstddef>
+
+namespace tyr::planning
+{
+
+enum class StateStorageKind
+{
+    HASH_SET,
+    TREE_COMPRESSION,
+    /// @brief Start with HASH_SET and migrate to TREE_COMPRESSION once `migration_threshold` is exceeded.
+    AUTOMATIC,
+};
+
+/// @brief Runtime selection of the state storage backend.
+/// Only honored when built with `TYR_STATE_STORAGE_POLICY=Dynamic`, fixed policies ignore it.
+struct StateStorageOptions
+{
+    StateStorageKind kind = StateStorageKind::AUTOMATIC;
+    size_t migration_threshold = size_t(1) << 30;  ///< in bytes
+};
+
+}
+
+#endif
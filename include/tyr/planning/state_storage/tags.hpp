@@ -27,6 +27,11 @@ struct TreeCompression
 struct HashSet
 {
 };
+
+/// @brief Selects between `HashSet` and `TreeCompression` at runtime, see `StateStorageOptions`.
+struct Dynamic
+{
+};
 }
 
 #endif
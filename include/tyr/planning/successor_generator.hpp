@@ -37,11 +37,13 @@ concept SuccessorGeneratorConcept = requires(T& r,
                                              Index<State<Kind>> state_index,
                                              const Node<Kind>& node,
                                              std::vector<LabeledNode<Kind>>& labeled_successor_nodes,
+                                             std::vector<formalism::planning::GroundActionView>& applicable_actions,
                                              formalism::planning::GroundActionView action) {
     requires TaskKind<Kind>;
     { r.get_initial_node() } -> std::same_as<Node<Kind>>;
     { r.get_labeled_successor_nodes(node) } -> std::same_as<std::vector<LabeledNode<Kind>>>;
     { r.get_labeled_successor_nodes(node, labeled_successor_nodes) } -> std::same_as<void>;
+    { r.get_applicable_actions(node, applicable_actions) } -> std::same_as<void>;
     { r.get_successor_node(node, action) } -> std::same_as<Node<Kind>>;
     { r.get_node(state_index) } -> std::same_as<Node<Kind>>;
 };
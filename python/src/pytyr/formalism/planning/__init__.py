@@ -15,6 +15,7 @@ from pytyr.pytyr.formalism.planning import (
 
 from pytyr.pytyr.formalism.planning import (
     Invariant,
+    InvariantSynthesisOptions,
     synthesize_invariants,
     ObjectSubstitution,
     TermSubstitution,
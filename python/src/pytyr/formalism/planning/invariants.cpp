@@ -124,6 +124,15 @@ void bind_invariant_match_data(nb::module_& m, const std::string& name)
         .def_prop_ro("rigid_variable_bindings", &V::rigid_variable_bindings, nb::rv_policy::reference_internal);
 }
 
+void bind_synthesis_options(nb::module_& m, const std::string& name)
+{
+    using V = SynthesisOptions;
+
+    nb::class_<V>(m, name.c_str())  //
+        .def(nb::init<>())
+        .def_rw("max_time", &V::max_time);
+}
+
 void bind_query_workspace(nb::module_& m, const std::string& name)
 {
     using V = QueryWorkspace;
@@ -183,6 +192,15 @@ void bind_invariants(nb::module_& m)
     bind_query_result(m, "InvariantQueryResult");
     bind_matcher(m, "InvariantMatcher");
 
-    m.def("synthesize_invariants", &invariant::synthesize_invariants, "domain"_a);
+    bind_synthesis_options(m, "InvariantSynthesisOptions");
+
+    m.def("synthesize_invariants", nb::overload_cast<DomainView>(&invariant::synthesize_invariants), "domain"_a);
+    m.def(
+        "synthesize_invariants",
+        [](DomainView domain, std::shared_ptr<ExecutionContext> execution_context, const SynthesisOptions& options)
+        { return invariant::synthesize_invariants(domain, *execution_context, options); },
+        "domain"_a,
+        "execution_context"_a,
+        "options"_a = SynthesisOptions());
 }
 }
@@ -389,7 +389,8 @@ void bind_projection_abstraction(nb::module_& m, const std::string& name)
 {
     using T = ProjectionAbstraction<Kind>;
 
-    nb::class_<T>(m, name.c_str());
+    nb::class_<T>(m, name.c_str())  //
+        .def("num_abstract_states", [](const T& self) { return self.get_mapping().num_abstract_states(); });
 }
 
 template<TaskKind Kind>
@@ -416,8 +417,12 @@ void bind_projection_generator(nb::module_& m, const std::string& name)
     using T = ProjectionGenerator<Kind>;
 
     nb::class_<T>(m, name.c_str())  //
-        .def(nb::init<std::shared_ptr<const Task<Kind>>, PatternCollection>(), "task"_a, "patterns"_a)
-        .def("generate", &T::generate);
+        .def(nb::init<std::shared_ptr<const Task<Kind>>, PatternCollection, ProjectionGeneratorOptions>(),
+             "task"_a,
+             "patterns"_a,
+             "options"_a = ProjectionGeneratorOptions())
+        .def("generate", &T::generate)
+        .def("get_statistics", &T::get_statistics, nb::rv_policy::reference_internal);
 }
 
 }
@@ -497,10 +502,18 @@ void bind_lifted_module_definitions(nb::module_& m)
         .def_rw("task", &GroundTaskInstantiationResult::task)
         .def_rw("status", &GroundTaskInstantiationResult::status);
 
+    nb::enum_<ActionMatcherKind>(m, "ActionMatcherKind")
+        .value("MATCH_TREE", ActionMatcherKind::MATCH_TREE)
+        .value("BITSET", ActionMatcherKind::BITSET)
+        .value("AUTOMATIC", ActionMatcherKind::AUTOMATIC);
+
     nb::class_<GroundTaskInstantiationOptions>(m, "GroundTaskInstantiationOptions")
         .def(nb::init<>())
         .def(nb::init<bool>(), "disable_invariant_synthesis"_a = true)
-        .def_rw("disable_invariant_synthesis", &GroundTaskInstantiationOptions::disable_invariant_synthesis);
+        .def_rw("disable_invariant_synthesis", &GroundTaskInstantiationOptions::disable_invariant_synthesis)
+        .def_rw("max_invariant_synthesis_time", &GroundTaskInstantiationOptions::max_invariant_synthesis_time)
+        .def_rw("enable_relevance_analysis", &GroundTaskInstantiationOptions::enable_relevance_analysis)
+        .def_rw("action_matcher", &GroundTaskInstantiationOptions::action_matcher);
 
     nb::class_<Task<LiftedTag>>(m, "Task")  //
         .def(nb::new_([](formalism::planning::PlanningTask&& task) { return Task<LiftedTag>::create(std::move(task)); }),
@@ -551,6 +564,17 @@ should not be used further.
     bind_goal_pattern_generator<LiftedTag>(m, "GoalPatternGenerator");
     bind_projection_abstraction<LiftedTag>(m, "ProjectionAbstraction");
     bind_vector<ProjectionAbstractionList<LiftedTag>>(m, "ProjectionAbstractionList");
+
+    nb::class_<ProjectionGeneratorOptions>(m, "ProjectionGeneratorOptions")
+        .def(nb::init<>())
+        .def_rw("mutex_groups", &ProjectionGeneratorOptions::mutex_groups)
+        .def_rw("cache_directory", &ProjectionGeneratorOptions::cache_directory);
+
+    nb::class_<ProjectionGeneratorStatistics>(m, "ProjectionGeneratorStatistics")
+        .def(nb::init<>())
+        .def_ro("num_loaded_projections", &ProjectionGeneratorStatistics::num_loaded_projections)
+        .def_ro("num_stored_projections", &ProjectionGeneratorStatistics::num_stored_projections);
+
     bind_projection_generator<LiftedTag>(m, "ProjectionGenerator");
 }
 
@@ -611,6 +635,7 @@ void bind_options(nb::module_& m, const std::string& name)
         .def_rw("goal_strategy", &T::goal_strategy)
         .def_rw("max_num_states", &T::max_num_states)
         .def_rw("max_time", &T::max_time)
+        .def_rw("max_memory", &T::max_memory)
         .def_rw("random_seed", &T::random_seed)
         .def_rw("shuffle_labeled_succ_nodes", &T::shuffle_labeled_succ_nodes);
 }
@@ -695,7 +720,10 @@ public:
 
     void on_expand_goal_node(const Node<Kind>& node) override { NB_OVERRIDE_PURE(on_expand_goal_node, node); }
 
-    void on_generate_node(const LabeledNode<Kind>& labeled_succ_node) override { NB_OVERRIDE_PURE(on_generate_node, labeled_succ_node); }
+    void on_generate_node(formalism::planning::GroundActionView label, const Node<Kind>& succ_node) override
+    {
+        NB_OVERRIDE_PURE(on_generate_node, label, succ_node);
+    }
 
     void on_prune_node(const Node<Kind>& node) override { NB_OVERRIDE_PURE(on_prune_node, node); }
 
@@ -725,6 +753,7 @@ void bind_options(nb::module_& m, const std::string& name)
         .def_rw("goal_strategy", &T::goal_strategy)
         .def_rw("max_num_states", &T::max_num_states)
         .def_rw("max_time", &T::max_time)
+        .def_rw("max_memory", &T::max_memory)
         .def_rw("boost_preferred_queue", &T::boost_preferred_queue)
         .def_rw("random_seed", &T::random_seed)
         .def_rw("shuffle_labeled_succ_nodes", &T::shuffle_labeled_succ_nodes);
@@ -752,7 +781,7 @@ void bind_event_handler(nb::module_& m, const std::string& name)
     nb::class_<T, PyEventHandler<Kind>>(m, name.c_str())
         .def("on_expand_node", &T::on_expand_node, "node"_a)
         .def("on_expand_goal_node", &T::on_expand_goal_node, "node"_a)
-        .def("on_generate_node", &T::on_generate_node, "labeled_suc_node"_a)
+        .def("on_generate_node", &T::on_generate_node, "label"_a, "succ_node"_a)
         .def("on_prune_node", &T::on_prune_node, "node"_a)
         .def("on_start_search", &T::on_start_search, "node"_a, "h_value"_a)
         .def("on_new_best_h_value", &T::on_new_best_h_value, "h_value"_a)
@@ -34,6 +34,8 @@ from pytyr.pytyr.planning.lifted import (
     GoalPatternGenerator,
     ProjectionAbstraction,
     ProjectionAbstractionList,
+    ProjectionGeneratorOptions,
+    ProjectionGeneratorStatistics,
     ProjectionGenerator,
 )
 
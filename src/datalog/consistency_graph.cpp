@@ -34,6 +34,7 @@
 #include "tyr/formalism/datalog/merge.hpp"
 #include "tyr/formalism/datalog/repository.hpp"
 #include "tyr/formalism/datalog/views.hpp"
+#include "tyr/formalism/numeric_bytecode.hpp"
 
 #include <boost/dynamic_bitset/dynamic_bitset.hpp>
 #include <optional>
@@ -143,36 +144,6 @@ template<f::FactKind T>
 ClosedInterval<float_t>
 consistent_interval(const RuleToFunctionTermInfo<T>& info, const Edge& edge, const FunctionAssignmentSets<T>& function_assignment_sets) noexcept;
 
-template<f::ArithmeticOpKind O, typename GraphStructure>
-ClosedInterval<float_t> consistent_interval(fd::LiftedUnaryOperatorView<O> element,
-                                            const GraphStructure& structure,
-                                            const RuleToConstraintInfo& constraint_info,
-                                            const AssignmentSets& assignment_sets) noexcept;
-
-template<f::ArithmeticOpKind O, typename GraphStructure>
-ClosedInterval<float_t> consistent_interval(fd::LiftedBinaryOperatorView<O> element,
-                                            const GraphStructure& structure,
-                                            const RuleToConstraintInfo& constraint_info,
-                                            const AssignmentSets& assignment_sets) noexcept;
-
-template<f::ArithmeticOpKind O, typename GraphStructure>
-ClosedInterval<float_t> consistent_interval(fd::LiftedMultiOperatorView<O> element,
-                                            const GraphStructure& structure,
-                                            const RuleToConstraintInfo& constraint_info,
-                                            const AssignmentSets& assignment_sets) noexcept;
-
-template<typename GraphStructure>
-ClosedInterval<float_t> consistent_interval(fd::FunctionExpressionView element,
-                                            const GraphStructure& structure,
-                                            const RuleToConstraintInfo& constraint_info,
-                                            const AssignmentSets& assignment_sets) noexcept;
-
-template<typename GraphStructure>
-ClosedInterval<float_t> consistent_interval(fd::LiftedArithmeticOperatorView element,
-                                            const GraphStructure& structure,
-                                            const RuleToConstraintInfo& constraint_info,
-                                            const AssignmentSets& assignment_sets) noexcept;
-
 template<typename GraphStructure>
 bool consistent_numeric_constraint(fd::LiftedBooleanOperatorView element,
                                    const GraphStructure& structure,
@@ -408,91 +379,29 @@ consistent_interval(const RuleToFunctionTermInfo<T>& info, const Edge& edge, con
     return bounds;
 }
 
-template<f::ArithmeticOpKind O, typename GraphStructure>
-inline ClosedInterval<float_t> consistent_interval(fd::LiftedUnaryOperatorView<O> element,
-                                                   const GraphStructure& structure,
-                                                   const RuleToConstraintInfo& constraint_info,
-                                                   const AssignmentSets& assignment_sets) noexcept
-{
-    return apply(O {}, consistent_interval(element.get_arg(), structure, constraint_info, assignment_sets));
-}
-
-template<f::ArithmeticOpKind O, typename GraphStructure>
-inline ClosedInterval<float_t> consistent_interval(fd::LiftedBinaryOperatorView<O> element,
-                                                   const GraphStructure& structure,
-                                                   const RuleToConstraintInfo& constraint_info,
-                                                   const AssignmentSets& assignment_sets) noexcept
-{
-    return apply(O {},
-                 consistent_interval(element.get_lhs(), structure, constraint_info, assignment_sets),
-                 consistent_interval(element.get_rhs(), structure, constraint_info, assignment_sets));
-}
-
-template<f::ArithmeticOpKind O, typename GraphStructure>
-inline ClosedInterval<float_t> consistent_interval(fd::LiftedMultiOperatorView<O> element,
-                                                   const GraphStructure& structure,
-                                                   const RuleToConstraintInfo& constraint_info,
-                                                   const AssignmentSets& assignment_sets) noexcept
-{
-    const auto child_fexprs = element.get_args();
-
-    return std::accumulate(std::next(child_fexprs.begin()),  // Start from the second expression
-                           child_fexprs.end(),
-                           consistent_interval(child_fexprs.front(), structure, constraint_info, assignment_sets),
-                           [&](const auto& value, const auto& child_expr)
-                           { return apply(O {}, value, consistent_interval(child_expr, structure, constraint_info, assignment_sets)); });
-}
-
-template<typename GraphStructure>
-inline ClosedInterval<float_t> consistent_interval(fd::FunctionExpressionView element,
-                                                   const GraphStructure& structure,
-                                                   const RuleToConstraintInfo& constraint_info,
-                                                   const AssignmentSets& assignment_sets) noexcept
-{
-    return visit(
-        [&](auto&& arg)
-        {
-            using Alternative = std::decay_t<decltype(arg)>;
-
-            if constexpr (std::is_same_v<Alternative, float_t>)
-                return ClosedInterval<float_t>(arg, arg);
-            else if constexpr (std::is_same_v<Alternative, fd::LiftedArithmeticOperatorView>)
-                return consistent_interval(arg, structure, constraint_info, assignment_sets);
-            else if constexpr (std::is_same_v<Alternative, fd::FunctionTermView<f::StaticTag>>)
-                return consistent_interval(constraint_info.static_infos.infos.at(arg.get_index()), structure, assignment_sets.static_sets.function);
-            else if constexpr (std::is_same_v<Alternative, fd::FunctionTermView<f::FluentTag>>)
-                return consistent_interval(constraint_info.fluent_infos.infos.at(arg.get_index()), structure, assignment_sets.fluent_sets.function);
-            else
-                static_assert(dependent_false<Alternative>::value, "Missing case");
-        },
-        element.get_variant());
-}
-
-template<typename GraphStructure>
-inline ClosedInterval<float_t> consistent_interval(fd::LiftedArithmeticOperatorView element,
-                                                   const GraphStructure& structure,
-                                                   const RuleToConstraintInfo& constraint_info,
-                                                   const AssignmentSets& assignment_sets) noexcept
-{
-    return visit([&](auto&& arg) { return consistent_interval(arg, structure, constraint_info, assignment_sets); }, element.get_variant());
-}
-
 template<typename GraphStructure>
 inline bool consistent_numeric_constraint(fd::LiftedBooleanOperatorView element,
                                           const GraphStructure& structure,
                                           const RuleToConstraintInfo& constraint_info,
                                           const AssignmentSets& assignment_sets) noexcept
 {
-    return visit(
-        [&](auto&& arg) -> bool
-        {
-            using Alternative = std::decay_t<decltype(arg)>;
-
-            return apply_existential(typename Alternative::OpType {},
-                                     consistent_interval(arg.get_lhs(), structure, constraint_info, assignment_sets),
-                                     consistent_interval(arg.get_rhs(), structure, constraint_info, assignment_sets));
-        },
-        element.get_variant());
+    const auto load = [&](const f::NumericInstruction& instruction)
+    {
+        if (instruction.opcode == f::NumericOpCode::LOAD_STATIC)
+            return consistent_interval(constraint_info.static_infos.infos.at(Index<fd::FunctionTerm<f::StaticTag>>(instruction.arg)),
+                                       structure,
+                                       assignment_sets.static_sets.function);
+
+        assert(instruction.opcode == f::NumericOpCode::LOAD_FLUENT);
+        return consistent_interval(constraint_info.fluent_infos.infos.at(Index<fd::FunctionTerm<f::FluentTag>>(instruction.arg)),
+                                   structure,
+                                   assignment_sets.fluent_sets.function);
+    };
+
+    return f::evaluate<ClosedInterval<float_t>>(constraint_info.bytecode,
+                                                constraint_info.code,
+                                                load,
+                                                [](auto op, const auto& lhs, const auto& rhs) { return apply_existential(op, lhs, rhs); });
 }
 
 inline bool consistent_numeric_constraints(const Vertex& vertex,
@@ -954,6 +863,20 @@ static auto compute_constraint_info(fd::LiftedBooleanOperatorView element, size_
 
     result.kpkc_arity = kpkc_arity(element);
 
+    result.code = f::compile_constraint(element,
+                                        result.bytecode,
+                                        [](f::NumericBytecode& bytecode, auto&& fterm)
+                                        {
+                                            using Alternative = std::decay_t<decltype(fterm)>;
+
+                                            if constexpr (std::is_same_v<Alternative, fd::FunctionTermView<f::StaticTag>>)
+                                                bytecode.emit_load(f::NumericOpCode::LOAD_STATIC, uint_t(fterm.get_index()));
+                                            else if constexpr (std::is_same_v<Alternative, fd::FunctionTermView<f::FluentTag>>)
+                                                bytecode.emit_load(f::NumericOpCode::LOAD_FLUENT, uint_t(fterm.get_index()));
+                                            else
+                                                static_assert(dependent_false<Alternative>::value, "Missing case");
+                                        });
+
     return result;
 }
 
@@ -19,6 +19,7 @@
 
 #include "normalization.hpp"
 #include "refinement.hpp"
+#include "tyr/common/chrono.hpp"
 #include "tyr/common/comparators.hpp"
 #include "tyr/common/declarations.hpp"
 #include "tyr/common/equal_to.hpp"
@@ -32,7 +33,9 @@
 #include "tyr/formalism/planning/repository.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <map>
+#include <oneapi/tbb/parallel_for.h>
 #include <optional>
 #include <unordered_set>
 #include <variant>
@@ -41,6 +44,13 @@
 namespace tyr::formalism::planning::invariant
 {
 InvariantList synthesize_invariants(DomainView domain)
+{
+    auto execution_context = ExecutionContext(1);
+
+    return synthesize_invariants(domain, execution_context);
+}
+
+InvariantList synthesize_invariants(DomainView domain, ExecutionContext& execution_context, const SynthesisOptions& options)
 {
     auto ops = MutableActionList {};
     for (const auto& action : domain.get_actions())
@@ -51,30 +61,68 @@ InvariantList synthesize_invariants(DomainView domain)
     auto accepted = InvariantList {};
     auto seen = UnorderedSet<Invariant> {};
 
+    auto stopwatch = options.max_time ? std::optional<CountdownWatch>(options.max_time.value()) : std::nullopt;
+
+    auto candidates = InvariantList {};
+    auto is_proven = std::vector<uint8_t> {};
+    auto refinements = std::vector<InvariantList> {};
+
     while (!queue.empty())
     {
-        auto candidate = std::move(queue.back());
-        queue.pop_back();
+        /* Normalize and deduplicate the candidates of the current round. */
+
+        candidates.clear();
+        for (auto& candidate : queue)
+        {
+            candidate = Invariant(candidate.num_rigid_variables, candidate.num_counted_variables, std::move(candidate.atoms));
+
+            normalize_invariant(candidate);
 
-        candidate = Invariant(candidate.num_rigid_variables, candidate.num_counted_variables, std::move(candidate.atoms));
+            if (seen.insert(candidate).second)
+                candidates.push_back(std::move(candidate));
+        }
+        queue.clear();
+
+        /* Prove and refine the candidates in parallel, each writing its own slot. */
 
-        normalize_invariant(candidate);
+        is_proven.assign(candidates.size(), false);
+        refinements.assign(candidates.size(), InvariantList {});
 
-        if (!seen.insert(candidate).second)
-            continue;
+        const auto prove_candidate = [&](size_t i)
+        {
+            if (stopwatch && stopwatch->has_finished())
+                return;
 
-        auto result = prove_invariant(candidate, ops);
+            auto result = prove_invariant(candidates[i], ops);
 
-        if (result.status == ProofStatus::Proven)
+            if (result.status == ProofStatus::Proven)
+                is_proven[i] = true;
+            else if (result.status == ProofStatus::UnbalancedAddEffect)
+                refinements[i] = refine_candidate(candidates[i], *result.threat, ops, domain.get_predicates<FluentTag>());
+        };
+
+        if (execution_context.get_num_threads() == 1)
         {
-            accepted.push_back(std::move(candidate));
+            for (size_t i = 0; i < candidates.size(); ++i)
+                prove_candidate(i);
         }
-        else if (result.status == ProofStatus::UnbalancedAddEffect)
+        else
         {
-            auto refined = refine_candidate(candidate, *result.threat, ops, domain.get_predicates<FluentTag>());
+            execution_context.arena().execute([&] { oneapi::tbb::parallel_for(size_t(0), candidates.size(), prove_candidate); });
+        }
 
-            queue.insert(queue.end(), std::make_move_iterator(refined.begin()), std::make_move_iterator(refined.end()));
+        /* Collect the results in candidate order to keep the next round deterministic. */
+
+        for (size_t i = 0; i < candidates.size(); ++i)
+        {
+            if (is_proven[i])
+                accepted.push_back(std::move(candidates[i]));
+
+            queue.insert(queue.end(), std::make_move_iterator(refinements[i].begin()), std::make_move_iterator(refinements[i].end()));
         }
+
+        if (stopwatch && stopwatch->has_finished())
+            break;
     }
 
     return accepted;
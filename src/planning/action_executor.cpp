@@ -28,6 +28,7 @@
 #include "tyr/planning/applicability_lifted.hpp"
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/ground_task/action_table.hpp"
 #include "tyr/planning/ground_task/node.hpp"
 #include "tyr/planning/ground_task/state_repository.hpp"
 #include "tyr/planning/ground_task/state_view.hpp"
@@ -38,6 +39,8 @@
 #include "tyr/planning/lifted_task/state_view.hpp"
 #include "tyr/planning/lifted_task/unpacked_state.hpp"
 
+#include <type_traits>
+
 namespace f = tyr::formalism;
 namespace fp = tyr::formalism::planning;
 
@@ -182,6 +185,18 @@ template bool ActionExecutor::is_applicable(fp::GroundActionView action, const S
 template<TaskKind Kind>
 Node<Kind> ActionExecutor::apply_action(const StateContext<Kind>& state_context, fp::GroundActionView action, StateRepository<Kind>& state_repository)
 {
+    if constexpr (std::is_same_v<Kind, GroundTag>)
+    {
+        const auto& action_table = state_context.task.get_action_table();
+        if (action_table.contains(action.get_index()))
+            return apply_action_impl(state_context,
+                                     state_repository,
+                                     m_del_effects,
+                                     m_add_effects,
+                                     [&](auto& succ_unpacked_state, auto& tmp_state_context, auto& del_effects, auto& add_effects)
+                                     { action_table.apply(action.get_index(), tmp_state_context, succ_unpacked_state, del_effects, add_effects); });
+    }
+
     return apply_action_impl(state_context,
                              state_repository,
                              m_del_effects,
@@ -18,11 +18,13 @@
 #include "tyr/planning/algorithms/astar_eager.hpp"
 
 #include "tyr/common/chrono.hpp"
+#include "tyr/common/memory.hpp"
 #include "tyr/common/segmented_vector.hpp"
 #include "tyr/formalism/planning/repository.hpp"
 #include "tyr/formalism/planning/views.hpp"
 #include "tyr/planning/algorithms/astar_eager/event_handler.hpp"
 #include "tyr/planning/algorithms/openlists/alternating.hpp"
+#include "tyr/planning/algorithms/strategies/dispatch.hpp"
 #include "tyr/planning/algorithms/strategies/goal.hpp"
 #include "tyr/planning/algorithms/strategies/pruning.hpp"
 #include "tyr/planning/algorithms/utils.hpp"
@@ -88,31 +90,35 @@ template<TaskKind Kind>
 struct QueueEntry
 {
     using KeyType = std::tuple<float_t, SearchNodeStatus>;
-    using ItemType = std::tuple<float_t, Index<State<Kind>>>;
+    using ItemType = std::tuple<float_t, float_t, Index<State<Kind>>>;  ///< the h-value allows incremental evaluation of the successors
 
     float_t f_value;
+    float_t h_value;
     Index<State<Kind>> state;
     SearchNodeStatus status;
 
     KeyType get_key() const { return std::make_tuple(f_value, status); }
-    ItemType get_item() const { return std::make_tuple(f_value, state); }
+    ItemType get_item() const { return std::make_tuple(f_value, h_value, state); }
 };
 
-static_assert(sizeof(QueueEntry<LiftedTag>) == 16);
-static_assert(sizeof(QueueEntry<GroundTag>) == 16);
+static_assert(sizeof(QueueEntry<LiftedTag>) == 24);
+static_assert(sizeof(QueueEntry<GroundTag>) == 24);
 
 template<TaskKind Kind>
 using Queue = PriorityQueue<QueueEntry<Kind>>;
 
-template<TaskKind Kind>
-SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& successor_generator, Heuristic<Kind>& heuristic, const Options<Kind>& options)
+template<TaskKind Kind, typename HeuristicType, typename PruningStrategyType, typename GoalStrategyType, typename EventHandlerType>
+static SearchResult<Kind> find_solution_impl(Task<Kind>& task,
+                                             SuccessorGenerator<Kind>& successor_generator,
+                                             HeuristicType& heuristic,
+                                             PruningStrategyType& pruning_strategy,
+                                             GoalStrategyType& goal_strategy,
+                                             EventHandlerType& event_handler,
+                                             const Options<Kind>& options)
 {
     const auto start_node = (options.start_node) ? options.start_node.value() : successor_generator.get_initial_node();
     const auto& start_state = start_node.get_state();
     const auto start_state_index = start_state.get_index();
-    const auto event_handler = (options.event_handler) ? options.event_handler : DefaultEventHandler<Kind>::create(0);
-    const auto pruning_strategy = (options.pruning_strategy) ? options.pruning_strategy : PruningStrategy<Kind>::create();
-    const auto goal_strategy = (options.goal_strategy) ? options.goal_strategy : TaskGoalStrategy<Kind>::create(task);
     auto rng = std::mt19937_64(options.random_seed);
     auto& state_repository = *successor_generator.get_state_repository();
 
@@ -125,14 +131,14 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
     start_search_node.status = (start_h_value == std::numeric_limits<float_t>::infinity()) ? SearchNodeStatus::DEAD_END : SearchNodeStatus::OPEN;
     start_search_node.g_value = start_node.get_metric();
 
-    event_handler->on_start_search(start_node, start_f_value);
+    event_handler.on_start_search(start_node, start_f_value);
 
     /* Test static goal. */
 
-    if (!goal_strategy->is_static_goal_satisfied())
+    if (!goal_strategy.is_static_goal_satisfied())
     {
-        event_handler->on_end_search();
-        event_handler->on_unsolvable();
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
 
         result.status = SearchStatus::UNSOLVABLE;
         return result;
@@ -140,22 +146,22 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
 
     /* Test whether initial state is goal. */
 
-    if (goal_strategy->is_dynamic_goal_satisfied(start_state))
+    if (goal_strategy.is_dynamic_goal_satisfied(start_state))
     {
-        event_handler->on_end_search();
+        event_handler.on_end_search();
 
         result.plan = Plan(start_node, LabeledNodeList<Kind> {});
         result.goal_node = start_node;
         result.status = SearchStatus::SOLVED;
 
-        event_handler->on_solved(result.plan.value());
+        event_handler.on_solved(result.plan.value());
 
         return result;
     }
 
     if (std::isnan(start_node.get_metric()))
     {
-        event_handler->on_end_search();
+        event_handler.on_end_search();
 
         throw std::runtime_error("find_solution(...): start node metric value is NaN.");
     }
@@ -164,8 +170,8 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
 
     if (start_search_node.status == SearchNodeStatus::DEAD_END)
     {
-        event_handler->on_end_search();
-        event_handler->on_unsolvable();
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
 
         result.status = SearchStatus::UNSOLVABLE;
         return result;
@@ -173,38 +179,50 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
 
     /* Test whether initial state should be pruned. */
 
-    if (pruning_strategy->should_prune_state(start_state))
+    if (pruning_strategy.should_prune_state(start_state))
     {
-        event_handler->on_end_search();
-        event_handler->on_unsolvable();
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
 
         result.status = SearchStatus::EXHAUSTED;
         return result;
     }
 
     auto labeled_succ_nodes = std::vector<LabeledNode<Kind>> {};
+    auto relaxed_succ_nodes = std::vector<const LabeledNode<Kind>*> {};
+    auto relaxed_succ_states = std::vector<const StateView<Kind>*> {};
+    auto successor_h_values = std::vector<float_t> {};
     auto f_value = start_f_value;
-    openlist.insert(QueueEntry { start_f_value, start_state_index, start_search_node.status });
+    openlist.insert(QueueEntry { start_f_value, start_h_value, start_state_index, start_search_node.status });
 
     auto stopwatch = options.max_time ? std::optional<CountdownWatch>(options.max_time.value()) : std::nullopt;
+    auto memory_budget = options.max_memory ? std::optional<MemoryBudget>(options.max_memory.value()) : std::nullopt;
 
     while (!openlist.empty())
     {
         if (stopwatch && stopwatch->has_finished())
         {
-            event_handler->on_end_search();
+            event_handler.on_end_search();
 
             result.status = SearchStatus::OUT_OF_TIME;
             return result;
         }
 
-        const auto [state_f_value, state_index] = openlist.top();
-        const auto state = state_repository.get_registered_state(state_index);
+        if (memory_budget && memory_budget->is_exceeded(state_repository.memory_usage() + search_nodes.memory_usage() + openlist.memory_usage()))
+        {
+            event_handler.on_end_search();
+
+            result.status = SearchStatus::OUT_OF_MEMORY;
+            return result;
+        }
+
+        const auto [state_f_value, state_h_value, state_index] = openlist.top();
 
         openlist.pop();
 
         auto& search_node = get_or_create_search_node(state_index, search_nodes);
-        auto node = Node<Kind>(state, search_node.g_value);
+        const auto node = Node<Kind>(state_repository.get_registered_state(state_index), search_node.g_value);
+        const auto& state = node.get_state();
 
         /* Close state. */
 
@@ -215,7 +233,7 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
 
         if (state_f_value > f_value)
         {
-            event_handler->on_finish_f_layer(f_value);
+            event_handler.on_finish_f_layer(f_value);
             f_value = state_f_value;
         }
 
@@ -224,22 +242,22 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
         {
             search_node.status = SearchNodeStatus::GOAL;
 
-            event_handler->on_expand_goal_node(node);
+            event_handler.on_expand_goal_node(node);
 
-            event_handler->on_end_search();
+            event_handler.on_end_search();
 
             result.plan = extract_total_ordered_plan(search_node, node, search_nodes, successor_generator);
             result.goal_node = node;
             result.status = SearchStatus::SOLVED;
 
-            event_handler->on_solved(result.plan.value());
+            event_handler.on_solved(result.plan.value());
 
             return result;
         }
 
         /* Expand the successors of the node. */
 
-        event_handler->on_expand_node(node);
+        event_handler.on_expand_node(node);
 
         /* Ensure that the state is closed */
 
@@ -250,6 +268,9 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
         if (options.shuffle_labeled_succ_nodes)
             std::shuffle(labeled_succ_nodes.begin(), labeled_succ_nodes.end(), rng);
 
+        relaxed_succ_nodes.clear();
+        relaxed_succ_states.clear();
+
         for (const auto& labeled_succ_node : labeled_succ_nodes)
         {
             const auto& succ_node = labeled_succ_node.node;
@@ -264,7 +285,7 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
 
             if (is_new_successor_state && search_nodes.size() >= options.max_num_states)
             {
-                event_handler->on_end_search();
+                event_handler.on_end_search();
 
                 result.status = SearchStatus::OUT_OF_STATES;
                 return result;
@@ -272,10 +293,10 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
 
             /* Apply pruning strategy */
 
-            if (pruning_strategy->should_prune_successor_state(state, succ_state, is_new_successor_state))
+            if (pruning_strategy.should_prune_successor_state(state, succ_state, is_new_successor_state))
             {
                 successor_search_node.status = SearchNodeStatus::CLOSED;
-                event_handler->on_prune_node(succ_node);
+                event_handler.on_prune_node(succ_node);
                 continue;
             }
 
@@ -283,41 +304,85 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
 
             if (succ_node.get_metric() < successor_search_node.g_value)
             {
-                event_handler->on_generate_node(labeled_succ_node);
+                event_handler.on_generate_node(labeled_succ_node);
 
                 successor_search_node.parent_state = state_index;
                 successor_search_node.g_value = succ_node.get_metric();
+                // Provisional until the batch is evaluated, such that later duplicates are not considered new.
+                successor_search_node.status = SearchNodeStatus::OPEN;
 
-                const auto successor_h_value = FloatTolerance<float_t>::canonicalize(heuristic.evaluate(succ_state));
+                relaxed_succ_nodes.push_back(&labeled_succ_node);
+                relaxed_succ_states.push_back(&succ_state);
+            }
+            else
+            {
+                event_handler.on_generate_node_not_relaxed(labeled_succ_node);
+            }
+        }
+
+        /* Evaluate the relaxed successors, incrementally from the h-value stored with the expanded state if supported, and in one batch otherwise. */
+
+        successor_h_values.resize(relaxed_succ_states.size());
+        if (heuristic.has_incremental_evaluation())
+        {
+            for (size_t i = 0; i < relaxed_succ_states.size(); ++i)
+                successor_h_values[i] = heuristic.evaluate_successor(state, state_h_value, relaxed_succ_nodes[i]->label, *relaxed_succ_states[i]);
+        }
+        else
+        {
+            heuristic.evaluate_batch(relaxed_succ_states, successor_h_values);
+        }
 
-                if (successor_h_value == std::numeric_limits<float_t>::infinity())
-                {
-                    successor_search_node.status = SearchNodeStatus::DEAD_END;
-                    continue;
-                }
+        for (size_t i = 0; i < relaxed_succ_nodes.size(); ++i)
+        {
+            const auto& labeled_succ_node = *relaxed_succ_nodes[i];
+            const auto& succ_node = labeled_succ_node.node;
+            const auto& succ_state = succ_node.get_state();
+            const auto succ_state_index = succ_state.get_index();
 
-                const auto successor_is_goal_state = goal_strategy->is_dynamic_goal_satisfied(succ_state);
-                successor_search_node.status = successor_is_goal_state ? SearchNodeStatus::GOAL : SearchNodeStatus::OPEN;
+            auto& successor_search_node = get_or_create_search_node(succ_state_index, search_nodes);
 
-                event_handler->on_generate_node_relaxed(labeled_succ_node);
+            const auto successor_h_value = FloatTolerance<float_t>::canonicalize(successor_h_values[i]);
 
-                const auto successor_f_value = FloatTolerance<float_t>::canonicalize(succ_node.get_metric() + successor_h_value);
-                openlist.insert(QueueEntry { successor_f_value, succ_state_index, successor_search_node.status });
-            }
-            else
+            if (successor_h_value == std::numeric_limits<float_t>::infinity())
             {
-                event_handler->on_generate_node_not_relaxed(labeled_succ_node);
+                successor_search_node.status = SearchNodeStatus::DEAD_END;
+                continue;
             }
+
+            const auto successor_is_goal_state = goal_strategy.is_dynamic_goal_satisfied(succ_state);
+            successor_search_node.status = successor_is_goal_state ? SearchNodeStatus::GOAL : SearchNodeStatus::OPEN;
+
+            event_handler.on_generate_node_relaxed(labeled_succ_node);
+
+            const auto successor_f_value = FloatTolerance<float_t>::canonicalize(succ_node.get_metric() + successor_h_value);
+            openlist.insert(QueueEntry { successor_f_value, successor_h_value, succ_state_index, successor_search_node.status });
         }
     }
 
-    event_handler->on_end_search();
-    event_handler->on_exhausted();
+    event_handler.on_end_search();
+    event_handler.on_exhausted();
 
     result.status = SearchStatus::EXHAUSTED;
     return result;
 }
 
+template<TaskKind Kind>
+SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& successor_generator, Heuristic<Kind>& heuristic, const Options<Kind>& options)
+{
+    const auto event_handler = (options.event_handler) ? options.event_handler : DefaultEventHandler<Kind>::create(0);
+    const auto pruning_strategy = (options.pruning_strategy) ? options.pruning_strategy : NoPruningStrategy<Kind>::create();
+    const auto goal_strategy = (options.goal_strategy) ? options.goal_strategy : TaskGoalStrategy<Kind>::create(task);
+
+    return dispatch_search_policies<DefaultEventHandler<Kind>>(
+        heuristic,
+        *pruning_strategy,
+        *goal_strategy,
+        *event_handler,
+        [&](auto& heuristic_, auto& pruning_strategy_, auto& goal_strategy_, auto& event_handler_)
+        { return find_solution_impl(task, successor_generator, heuristic_, pruning_strategy_, goal_strategy_, event_handler_, options); });
+}
+
 template SearchResult<LiftedTag> find_solution<LiftedTag>(Task<LiftedTag>& task,
                                                           SuccessorGenerator<LiftedTag>& successor_generator,
                                                           Heuristic<LiftedTag>& heuristic,
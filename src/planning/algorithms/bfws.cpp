@@ -0,0 +1,393 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/algorithms/bfws.hpp"
+
+#include "tyr/common/chrono.hpp"
+#include "tyr/common/declarations.hpp"
+#include "tyr/common/memory.hpp"
+#include "tyr/common/segmented_vector.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/formalism/planning/views.hpp"
+#include "tyr/planning/algorithms/gbfs_lazy/event_handler.hpp"
+#include "tyr/planning/algorithms/openlists/priority_queue.hpp"
+#include "tyr/planning/algorithms/strategies/dispatch.hpp"
+#include "tyr/planning/algorithms/strategies/goal.hpp"
+#include "tyr/planning/algorithms/strategies/pruning.hpp"
+#include "tyr/planning/algorithms/utils.hpp"
+#include "tyr/planning/applicability.hpp"
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/ground_task/node.hpp"
+#include "tyr/planning/ground_task/state_repository.hpp"
+#include "tyr/planning/ground_task/state_view.hpp"
+#include "tyr/planning/ground_task/successor_generator.hpp"
+#include "tyr/planning/ground_task/unpacked_state.hpp"
+#include "tyr/planning/heuristic.hpp"
+#include "tyr/planning/lifted_task.hpp"
+#include "tyr/planning/lifted_task/node.hpp"
+#include "tyr/planning/lifted_task/state_repository.hpp"
+#include "tyr/planning/lifted_task/state_view.hpp"
+#include "tyr/planning/lifted_task/successor_generator.hpp"
+#include "tyr/planning/lifted_task/unpacked_state.hpp"
+#include "tyr/planning/novelty.hpp"
+#include "tyr/planning/search_node.hpp"
+#include "tyr/planning/search_space.hpp"
+#include "tyr/planning/state_index.hpp"
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+
+namespace tyr::planning::bfws
+{
+
+/**
+ * BFWS search node
+ */
+
+template<TaskKind Kind>
+struct SearchNode
+{
+    float_t g_value;
+    Index<State<Kind>> parent_state;
+    SearchNodeStatus status;
+};
+
+static_assert(sizeof(SearchNode<LiftedTag>) == 16);
+static_assert(sizeof(SearchNode<GroundTag>) == 16);
+
+template<TaskKind Kind>
+using SearchNodeVector = SegmentedVector<SearchNode<Kind>>;
+
+template<TaskKind Kind>
+static SearchNode<Kind>& get_or_create_search_node(Index<State<Kind>> state_index, SearchNodeVector<Kind>& search_nodes)
+{
+    static auto default_node = SearchNode { std::numeric_limits<float_t>::infinity(), Index<State<Kind>>::max(), SearchNodeStatus::NEW };
+
+    while (uint_t(state_index) >= search_nodes.size())
+    {
+        search_nodes.push_back(default_node);
+    }
+    return search_nodes[uint_t(state_index)];
+}
+
+/**
+ * BFWS queue
+ */
+
+template<TaskKind Kind>
+struct QueueEntry
+{
+    using KeyType = std::tuple<uint_t, float_t, float_t, uint_t>;
+    using ItemType = std::tuple<float_t, Index<State<Kind>>>;  ///< the h-value allows incremental evaluation of the successors
+
+    float_t g_value;
+    float_t h_value;
+    Index<State<Kind>> state;
+    uint_t novelty;
+    uint_t step;
+
+    KeyType get_key() const { return std::make_tuple(novelty, h_value, g_value, step); }
+    ItemType get_item() const { return std::make_tuple(h_value, state); }
+};
+
+static_assert(sizeof(QueueEntry<LiftedTag>) == 32);
+static_assert(sizeof(QueueEntry<GroundTag>) == 32);
+
+template<TaskKind Kind>
+using Queue = PriorityQueue<QueueEntry<Kind>>;
+
+/// @brief The novelty tables, one per h-value.
+template<TaskKind Kind>
+class PartitionedNoveltyTables
+{
+public:
+    PartitionedNoveltyTables(const Task<Kind>& task, uint_t arity) : m_task(task), m_arity(arity), m_tables() {}
+
+    uint_t compute_novelty_and_insert(float_t h_value, const StateView<Kind>& state)
+    {
+        auto it = m_tables.find(h_value);
+        if (it == m_tables.end())
+            it = m_tables.emplace(h_value, NoveltyTable<Kind>(m_task, m_arity)).first;
+
+        return it->second.compute_novelty_and_insert(state);
+    }
+
+    size_t memory_usage() const noexcept
+    {
+        auto usage = size_t(0);
+        for (const auto& [h_value, table] : m_tables)
+            usage += table.memory_usage();
+        return usage;
+    }
+
+private:
+    const Task<Kind>& m_task;
+    uint_t m_arity;
+    UnorderedMap<float_t, NoveltyTable<Kind>> m_tables;
+};
+
+template<TaskKind Kind, typename HeuristicType, typename PruningStrategyType, typename GoalStrategyType, typename EventHandlerType>
+static SearchResult<Kind> find_solution_impl(Task<Kind>& task,
+                                             SuccessorGenerator<Kind>& successor_generator,
+                                             HeuristicType& heuristic,
+                                             PruningStrategyType& pruning_strategy,
+                                             GoalStrategyType& goal_strategy,
+                                             EventHandlerType& event_handler,
+                                             const Options<Kind>& options)
+{
+    const auto start_node = (options.start_node) ? options.start_node.value() : successor_generator.get_initial_node();
+    const auto& start_state = start_node.get_state();
+    const auto start_state_index = start_state.get_index();
+    auto rng = std::mt19937_64(options.random_seed);
+    auto& state_repository = *successor_generator.get_state_repository();
+
+    auto step = uint_t(0);
+    auto result = SearchResult<Kind>();
+    auto search_nodes = SearchNodeVector<Kind>();
+    auto openlist = Queue<Kind>();
+    auto novelty_tables = PartitionedNoveltyTables<Kind>(task, options.arity);
+    const auto start_h_value = FloatTolerance<float_t>::canonicalize(heuristic.evaluate(start_state));
+    auto best_h_value = start_h_value;
+    auto& start_search_node = get_or_create_search_node(start_state_index, search_nodes);
+    start_search_node.status = (start_h_value == std::numeric_limits<float_t>::infinity()) ? SearchNodeStatus::DEAD_END : SearchNodeStatus::OPEN;
+    start_search_node.g_value = start_node.get_metric();
+
+    event_handler.on_start_search(start_node, start_h_value);
+
+    /* Test static goal. */
+
+    if (!goal_strategy.is_static_goal_satisfied())
+    {
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
+
+        result.status = SearchStatus::UNSOLVABLE;
+        return result;
+    }
+
+    /* Test whether initial state is goal. */
+
+    if (goal_strategy.is_dynamic_goal_satisfied(start_state))
+    {
+        event_handler.on_end_search();
+
+        result.plan = Plan(start_node, LabeledNodeList<Kind> {});
+        result.goal_node = start_node;
+        result.status = SearchStatus::SOLVED;
+
+        event_handler.on_solved(result.plan.value());
+
+        return result;
+    }
+
+    if (std::isnan(start_node.get_metric()))
+    {
+        event_handler.on_end_search();
+
+        throw std::runtime_error("find_solution(...): start node metric value is NaN.");
+    }
+
+    /* Test whether start state is deadend. */
+
+    if (start_search_node.status == SearchNodeStatus::DEAD_END)
+    {
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
+
+        result.status = SearchStatus::UNSOLVABLE;
+        return result;
+    }
+
+    /* Test whether initial state should be pruned. */
+
+    if (pruning_strategy.should_prune_state(start_state))
+    {
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
+
+        result.status = SearchStatus::EXHAUSTED;
+        return result;
+    }
+
+    const auto start_novelty = novelty_tables.compute_novelty_and_insert(start_h_value, start_state);
+
+    auto labeled_succ_nodes = std::vector<LabeledNode<Kind>> {};
+
+    openlist.insert(QueueEntry<Kind> { start_node.get_metric(), start_h_value, start_state_index, start_novelty, step++ });
+
+    auto stopwatch = options.max_time ? std::optional<CountdownWatch>(options.max_time.value()) : std::nullopt;
+    auto memory_budget = options.max_memory ? std::optional<MemoryBudget>(options.max_memory.value()) : std::nullopt;
+
+    while (!openlist.empty())
+    {
+        if (stopwatch && stopwatch->has_finished())
+        {
+            event_handler.on_end_search();
+
+            result.status = SearchStatus::OUT_OF_TIME;
+            return result;
+        }
+
+        if (memory_budget
+            && memory_budget->is_exceeded(state_repository.memory_usage() + search_nodes.memory_usage() + openlist.memory_usage()
+                                          + novelty_tables.memory_usage()))
+        {
+            event_handler.on_end_search();
+
+            result.status = SearchStatus::OUT_OF_MEMORY;
+            return result;
+        }
+
+        const auto [state_h_value, state_index] = openlist.top();
+
+        openlist.pop();
+
+        auto& search_node = get_or_create_search_node(state_index, search_nodes);
+
+        /* Close state. */
+
+        if (search_node.status == SearchNodeStatus::CLOSED || search_node.status == SearchNodeStatus::DEAD_END)
+            continue;
+
+        const auto node = Node<Kind>(state_repository.get_registered_state(state_index), search_node.g_value);
+        const auto& state = node.get_state();
+
+        /* Expand the successors of the node. */
+
+        event_handler.on_expand_node(node);
+
+        search_node.status = SearchNodeStatus::CLOSED;
+
+        successor_generator.get_labeled_successor_nodes(node, labeled_succ_nodes);
+
+        if (options.shuffle_labeled_succ_nodes)
+            std::shuffle(labeled_succ_nodes.begin(), labeled_succ_nodes.end(), rng);
+
+        for (const auto& labeled_succ_node : labeled_succ_nodes)
+        {
+            const auto& succ_node = labeled_succ_node.node;
+            const auto& succ_state = succ_node.get_state();
+            const auto succ_state_index = succ_state.get_index();
+
+            auto& successor_search_node = get_or_create_search_node(succ_state_index, search_nodes);
+
+            assert(!std::isnan(succ_node.get_metric()));
+
+            /* Skip previously generated state. */
+
+            if (successor_search_node.status != SearchNodeStatus::NEW)
+                continue;
+
+            if (search_nodes.size() >= options.max_num_states)
+            {
+                event_handler.on_end_search();
+
+                result.status = SearchStatus::OUT_OF_STATES;
+                return result;
+            }
+
+            /* Apply pruning strategy */
+
+            if (pruning_strategy.should_prune_successor_state(state, succ_state, true))
+            {
+                successor_search_node.status = SearchNodeStatus::CLOSED;
+                event_handler.on_prune_node(succ_node);
+                continue;
+            }
+
+            event_handler.on_generate_node(labeled_succ_node.label, labeled_succ_node.node);
+
+            successor_search_node.parent_state = state_index;
+            successor_search_node.g_value = succ_node.get_metric();
+
+            const auto successor_h_value =
+                FloatTolerance<float_t>::canonicalize(heuristic.evaluate_successor(state, state_h_value, labeled_succ_node.label, succ_state));
+
+            if (successor_h_value == std::numeric_limits<float_t>::infinity())
+            {
+                successor_search_node.status = SearchNodeStatus::DEAD_END;
+                continue;
+            }
+
+            successor_search_node.status = SearchNodeStatus::OPEN;
+
+            /* Goal test on generation. */
+
+            if (goal_strategy.is_dynamic_goal_satisfied(succ_state))
+            {
+                successor_search_node.status = SearchNodeStatus::GOAL;
+
+                event_handler.on_expand_goal_node(succ_node);
+
+                event_handler.on_end_search();
+
+                result.plan = extract_total_ordered_plan(successor_search_node, succ_node, search_nodes, successor_generator);
+                result.goal_node = succ_node;
+                result.status = SearchStatus::SOLVED;
+
+                event_handler.on_solved(result.plan.value());
+
+                return result;
+            }
+
+            if (successor_h_value < best_h_value)
+            {
+                best_h_value = successor_h_value;
+                event_handler.on_new_best_h_value(best_h_value);
+            }
+
+            const auto successor_novelty = novelty_tables.compute_novelty_and_insert(successor_h_value, succ_state);
+
+            openlist.insert(QueueEntry<Kind> { succ_node.get_metric(), successor_h_value, succ_state_index, successor_novelty, step++ });
+        }
+    }
+
+    event_handler.on_end_search();
+    event_handler.on_exhausted();
+
+    result.status = SearchStatus::EXHAUSTED;
+    return result;
+}
+
+template<TaskKind Kind>
+SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& successor_generator, Heuristic<Kind>& heuristic, const Options<Kind>& options)
+{
+    const auto event_handler = (options.event_handler) ? options.event_handler : gbfs_lazy::DefaultEventHandler<Kind>::create(0);
+    const auto pruning_strategy = (options.pruning_strategy) ? options.pruning_strategy : NoPruningStrategy<Kind>::create();
+    const auto goal_strategy = (options.goal_strategy) ? options.goal_strategy : TaskGoalStrategy<Kind>::create(task);
+
+    return dispatch_search_policies<gbfs_lazy::DefaultEventHandler<Kind>>(
+        heuristic,
+        *pruning_strategy,
+        *goal_strategy,
+        *event_handler,
+        [&](auto& heuristic_, auto& pruning_strategy_, auto& goal_strategy_, auto& event_handler_)
+        { return find_solution_impl(task, successor_generator, heuristic_, pruning_strategy_, goal_strategy_, event_handler_, options); });
+}
+
+template SearchResult<LiftedTag> find_solution<LiftedTag>(Task<LiftedTag>& task,
+                                                          SuccessorGenerator<LiftedTag>& successor_generator,
+                                                          Heuristic<LiftedTag>& heuristic,
+                                                          const Options<LiftedTag>& options);
+
+template SearchResult<GroundTag> find_solution<GroundTag>(Task<GroundTag>& task,
+                                                          SuccessorGenerator<GroundTag>& successor_generator,
+                                                          Heuristic<GroundTag>& heuristic,
+                                                          const Options<GroundTag>& options);
+
+}
@@ -18,11 +18,13 @@
 #include "tyr/planning/algorithms/gbfs_lazy.hpp"
 
 #include "tyr/common/chrono.hpp"
+#include "tyr/common/memory.hpp"
 #include "tyr/common/segmented_vector.hpp"
 #include "tyr/formalism/planning/repository.hpp"
 #include "tyr/formalism/planning/views.hpp"
 #include "tyr/planning/algorithms/gbfs_lazy/event_handler.hpp"
 #include "tyr/planning/algorithms/openlists/alternating.hpp"
+#include "tyr/planning/algorithms/strategies/dispatch.hpp"
 #include "tyr/planning/algorithms/strategies/goal.hpp"
 #include "tyr/planning/algorithms/strategies/pruning.hpp"
 #include "tyr/planning/algorithms/utils.hpp"
@@ -45,7 +47,9 @@
 #include "tyr/planning/state_index.hpp"
 
 #include <algorithm>
+#include <optional>
 #include <random>
+#include <tuple>
 
 namespace tyr::planning::gbfs_lazy
 {
@@ -60,7 +64,6 @@ struct SearchNode
     float_t g_value;
     Index<State<Kind>> parent_state;
     SearchNodeStatus status;
-    bool preferred;
 };
 
 static_assert(sizeof(SearchNode<LiftedTag>) == 16);
@@ -72,7 +75,7 @@ using SearchNodeVector = SegmentedVector<SearchNode<Kind>>;
 template<TaskKind Kind>
 static SearchNode<Kind>& get_or_create_search_node(Index<State<Kind>> state_index, SearchNodeVector<Kind>& search_nodes)
 {
-    static auto default_node = SearchNode { std::numeric_limits<float_t>::infinity(), Index<State<Kind>>::max(), SearchNodeStatus::NEW, false };
+    static auto default_node = SearchNode { std::numeric_limits<float_t>::infinity(), Index<State<Kind>>::max(), SearchNodeStatus::NEW };
 
     while (uint_t(state_index) >= search_nodes.size())
     {
@@ -85,20 +88,32 @@ static SearchNode<Kind>& get_or_create_search_node(Index<State<Kind>> state_inde
  * GBFS queue
  */
 
+/// @brief A transition whose successor state is only materialized when it is popped from the queue.
+template<TaskKind Kind>
+struct Transition
+{
+    Index<State<Kind>> parent_state = Index<State<Kind>>::max();
+    Index<formalism::planning::GroundAction> action = Index<formalism::planning::GroundAction>::max();  ///< max for the start state
+};
+
+static_assert(sizeof(Transition<LiftedTag>) == 8);
+static_assert(sizeof(Transition<GroundTag>) == 8);
+
+/// @brief Every entry is open and whether it is preferred is given by its queue, hence neither is stored.
+/// The g- and h-values are those of the parent, where the h-value allows incremental evaluation of the successor.
 template<TaskKind Kind>
 struct QueueEntry
 {
-    using KeyType = std::tuple<float_t, float_t, uint_t, SearchNodeStatus>;
-    using ItemType = Index<State<Kind>>;
+    using KeyType = std::tuple<float_t, float_t, uint_t>;
+    using ItemType = std::tuple<float_t, Transition<Kind>>;
 
     float_t g_value;
     float_t h_value;
-    Index<State<Kind>> state;
+    Transition<Kind> transition;
     uint_t step;
-    SearchNodeStatus status;
 
-    KeyType get_key() const { return std::make_tuple(h_value, g_value, step, status); }
-    ItemType get_item() const { return state; }
+    KeyType get_key() const { return std::make_tuple(h_value, g_value, step); }
+    ItemType get_item() const { return std::make_tuple(h_value, transition); }
 };
 
 static_assert(sizeof(QueueEntry<LiftedTag>) == 32);
@@ -107,15 +122,18 @@ static_assert(sizeof(QueueEntry<GroundTag>) == 32);
 template<TaskKind Kind>
 using Queue = PriorityQueue<QueueEntry<Kind>>;
 
-template<TaskKind Kind>
-SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& successor_generator, Heuristic<Kind>& heuristic, const Options<Kind>& options)
+template<TaskKind Kind, typename HeuristicType, typename PruningStrategyType, typename GoalStrategyType, typename EventHandlerType>
+static SearchResult<Kind> find_solution_impl(Task<Kind>& task,
+                                             SuccessorGenerator<Kind>& successor_generator,
+                                             HeuristicType& heuristic,
+                                             PruningStrategyType& pruning_strategy,
+                                             GoalStrategyType& goal_strategy,
+                                             EventHandlerType& event_handler,
+                                             const Options<Kind>& options)
 {
-    const auto start_node = (options.start_node) ? options.start_node.value() : successor_generator.get_initial_node();
+    auto start_node = (options.start_node) ? options.start_node.value() : successor_generator.get_initial_node();
     const auto& start_state = start_node.get_state();
     const auto start_state_index = start_state.get_index();
-    const auto event_handler = (options.event_handler) ? options.event_handler : DefaultEventHandler<Kind>::create(0);
-    const auto pruning_strategy = (options.pruning_strategy) ? options.pruning_strategy : PruningStrategy<Kind>::create();
-    const auto goal_strategy = (options.goal_strategy) ? options.goal_strategy : TaskGoalStrategy<Kind>::create(task);
     auto rng = std::mt19937_64(options.random_seed);
     auto& state_repository = *successor_generator.get_state_repository();
 
@@ -127,20 +145,18 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
     auto openlist = AlternatingOpenList<Queue<Kind>, Queue<Kind>>(preferred_openlist, standard_openlist, std::array<size_t, 2> { 1, 1 });
     const auto start_h_value = FloatTolerance<float_t>::canonicalize(heuristic.evaluate(start_state));
     auto best_h_value = start_h_value;
-    const auto start_preferred = false;
     auto& start_search_node = get_or_create_search_node(start_state_index, search_nodes);
     start_search_node.status = (start_h_value == std::numeric_limits<float_t>::infinity()) ? SearchNodeStatus::DEAD_END : SearchNodeStatus::OPEN;
     start_search_node.g_value = start_node.get_metric();
-    start_search_node.preferred = start_preferred;
 
-    event_handler->on_start_search(start_node, start_h_value);
+    event_handler.on_start_search(start_node, start_h_value);
 
     /* Test static goal. */
 
-    if (!goal_strategy->is_static_goal_satisfied())
+    if (!goal_strategy.is_static_goal_satisfied())
     {
-        event_handler->on_end_search();
-        event_handler->on_unsolvable();
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
 
         result.status = SearchStatus::UNSOLVABLE;
         return result;
@@ -148,22 +164,22 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
 
     /* Test whether initial state is goal. */
 
-    if (goal_strategy->is_dynamic_goal_satisfied(start_state))
+    if (goal_strategy.is_dynamic_goal_satisfied(start_state))
     {
-        event_handler->on_end_search();
+        event_handler.on_end_search();
 
         result.plan = Plan(start_node, LabeledNodeList<Kind> {});
         result.goal_node = start_node;
         result.status = SearchStatus::SOLVED;
 
-        event_handler->on_solved(result.plan.value());
+        event_handler.on_solved(result.plan.value());
 
         return result;
     }
 
     if (std::isnan(start_node.get_metric()))
     {
-        event_handler->on_end_search();
+        event_handler.on_end_search();
 
         throw std::runtime_error("find_solution(...): start node metric value is NaN.");
     }
@@ -172,8 +188,8 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
 
     if (start_search_node.status == SearchNodeStatus::DEAD_END)
     {
-        event_handler->on_end_search();
-        event_handler->on_unsolvable();
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
 
         result.status = SearchStatus::UNSOLVABLE;
         return result;
@@ -181,97 +197,77 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
 
     /* Test whether initial state should be pruned. */
 
-    if (pruning_strategy->should_prune_state(start_state))
+    if (pruning_strategy.should_prune_state(start_state))
     {
-        event_handler->on_end_search();
-        event_handler->on_unsolvable();
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
 
         result.status = SearchStatus::EXHAUSTED;
         return result;
     }
 
-    auto labeled_succ_nodes = std::vector<LabeledNode<Kind>> {};
+    auto applicable_actions = std::vector<formalism::planning::GroundActionView> {};
 
-    standard_openlist.insert(QueueEntry { start_node.get_metric(), start_h_value, start_state_index, step++, start_search_node.status });
+    standard_openlist.insert(
+        QueueEntry { start_node.get_metric(), start_h_value, Transition<Kind> { start_state_index, Index<formalism::planning::GroundAction>::max() }, step++ });
 
     auto stopwatch = options.max_time ? std::optional<CountdownWatch>(options.max_time.value()) : std::nullopt;
+    auto memory_budget = options.max_memory ? std::optional<MemoryBudget>(options.max_memory.value()) : std::nullopt;
 
     auto& openlist_weights = openlist.get_weights();
 
+    // The successors of an expansion share their priority and are therefore mostly popped in sequence.
+    auto parent_node = std::optional<Node<Kind>> {};
+
     while (!openlist.empty())
     {
         if (stopwatch && stopwatch->has_finished())
         {
-            event_handler->on_end_search();
+            event_handler.on_end_search();
 
             result.status = SearchStatus::OUT_OF_TIME;
             return result;
         }
 
-        const auto state_index = openlist.top();
-        const auto state = state_repository.get_registered_state(state_index);
-
-        openlist.pop();
-        // Weight decay of prefered queue
-        openlist_weights[0] = std::max(openlist_weights[0] - 1, size_t { 1 });
-
-        auto& search_node = get_or_create_search_node(state_index, search_nodes);
-        auto node = Node<Kind>(state, search_node.g_value);
-
-        /* Close state. */
-
-        if (search_node.status == SearchNodeStatus::CLOSED || search_node.status == SearchNodeStatus::DEAD_END)
+        if (memory_budget && memory_budget->is_exceeded(state_repository.memory_usage() + search_nodes.memory_usage() + openlist.memory_usage()))
         {
-            continue;
-        }
+            event_handler.on_end_search();
 
-        /* Expand the successors of the node. */
-
-        event_handler->on_expand_node(node);
-
-        const auto state_h_value = FloatTolerance<float_t>::canonicalize(heuristic.evaluate(state));
-        if (state_h_value == std::numeric_limits<float_t>::infinity())
-        {
-            search_node.status = SearchNodeStatus::DEAD_END;
-            continue;
+            result.status = SearchStatus::OUT_OF_MEMORY;
+            return result;
         }
 
-        if (state_h_value < best_h_value)
-        {
-            best_h_value = state_h_value;
-            event_handler->on_new_best_h_value(best_h_value);
+        const auto [parent_h_value, transition] = openlist.top();
 
-            // Boost prefered queue
-            openlist_weights[0] += options.boost_preferred_queue;
-        }
-
-        const auto& preferred_actions = heuristic.get_preferred_actions();
+        openlist.pop();
+        // Weight decay of prefered queue
+        openlist_weights[0] = std::max(openlist_weights[0] - 1, size_t { 1 });
 
-        /* Ensure that the state is closed */
+        const auto is_start_transition = (transition.action == Index<formalism::planning::GroundAction>::max());
 
-        search_node.status = SearchNodeStatus::CLOSED;
+        if (!is_start_transition && (!parent_node || parent_node->get_state().get_index() != transition.parent_state))
+            parent_node.emplace(state_repository.get_registered_state(transition.parent_state),
+                                get_or_create_search_node(transition.parent_state, search_nodes).g_value);
 
-        successor_generator.get_labeled_successor_nodes(node, labeled_succ_nodes);
+        /* Materialize the successor state. The start transition is popped exactly once and takes over the start node. */
 
-        if (options.shuffle_labeled_succ_nodes)
-            std::shuffle(labeled_succ_nodes.begin(), labeled_succ_nodes.end(), rng);
+        auto node = (is_start_transition) ?
+                        std::move(start_node) :
+                        successor_generator.get_successor_node(parent_node.value(), make_view(transition.action, *task.get_repository()));
 
-        for (const auto& labeled_succ_node : labeled_succ_nodes)
+        if (!is_start_transition)
         {
-            const auto& succ_node = labeled_succ_node.node;
-            const auto& succ_state = succ_node.get_state();
-            const auto succ_state_index = succ_state.get_index();
 
-            auto& successor_search_node = get_or_create_search_node(succ_state_index, search_nodes);
+            const auto& succ_state = node.get_state();
+            auto& successor_search_node = get_or_create_search_node(succ_state.get_index(), search_nodes);
 
-            assert(!std::isnan(succ_node.get_metric()));
+            assert(!std::isnan(node.get_metric()));
 
-            const auto is_preferred = preferred_actions.contains(labeled_succ_node.label.get_index());
             const auto is_new_successor_state = (successor_search_node.status == SearchNodeStatus::NEW);
 
             if (is_new_successor_state && search_nodes.size() >= options.max_num_states)
             {
-                event_handler->on_end_search();
+                event_handler.on_end_search();
 
                 result.status = SearchStatus::OUT_OF_STATES;
                 return result;
@@ -285,58 +281,127 @@ SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& suc
             /* Open new state. */
 
             successor_search_node.status = SearchNodeStatus::OPEN;
-            successor_search_node.parent_state = state_index;
-            successor_search_node.g_value = succ_node.get_metric();
-            successor_search_node.preferred = is_preferred;
+            successor_search_node.parent_state = transition.parent_state;
+            successor_search_node.g_value = node.get_metric();
 
-            /* Early goal test. */
+            /* Goal test. */
 
-            const auto successor_is_goal_state = goal_strategy->is_dynamic_goal_satisfied(succ_state);
+            const auto successor_is_goal_state = goal_strategy.is_dynamic_goal_satisfied(succ_state);
 
             if (successor_is_goal_state)
             {
                 successor_search_node.status = SearchNodeStatus::GOAL;
 
-                event_handler->on_expand_goal_node(succ_node);
+                event_handler.on_expand_goal_node(node);
 
-                event_handler->on_end_search();
+                event_handler.on_end_search();
 
-                result.plan = extract_total_ordered_plan(successor_search_node, succ_node, search_nodes, successor_generator);
-                result.goal_node = succ_node;
+                result.plan = extract_total_ordered_plan(successor_search_node, node, search_nodes, successor_generator);
+                result.goal_node = node;
                 result.status = SearchStatus::SOLVED;
 
-                event_handler->on_solved(result.plan.value());
+                event_handler.on_solved(result.plan.value());
 
                 return result;
             }
 
             /* Apply pruning strategy */
 
-            if (pruning_strategy->should_prune_successor_state(state, succ_state, is_new_successor_state))
+            if (pruning_strategy.should_prune_successor_state(parent_node->get_state(), succ_state, is_new_successor_state))
             {
                 successor_search_node.status = SearchNodeStatus::CLOSED;
-                event_handler->on_prune_node(succ_node);
+                event_handler.on_prune_node(node);
                 continue;
             }
 
-            event_handler->on_generate_node(labeled_succ_node);
+            event_handler.on_generate_node(make_view(transition.action, *task.get_repository()), node);
+        }
+
+        const auto& state = node.get_state();
+        const auto state_index = state.get_index();
+        auto& search_node = get_or_create_search_node(state_index, search_nodes);
+
+        /* Close state. */
+
+        if (search_node.status == SearchNodeStatus::CLOSED || search_node.status == SearchNodeStatus::DEAD_END)
+        {
+            continue;
+        }
+
+        /* Expand the successors of the node. */
+
+        event_handler.on_expand_node(node);
+
+        // The parent node is only replaced at the end of the expansion, such that it is still available here.
+        const auto state_h_value = FloatTolerance<float_t>::canonicalize(
+            (is_start_transition) ?
+                heuristic.evaluate(state) :
+                heuristic.evaluate_successor(parent_node->get_state(), parent_h_value, make_view(transition.action, *task.get_repository()), state));
+        if (state_h_value == std::numeric_limits<float_t>::infinity())
+        {
+            search_node.status = SearchNodeStatus::DEAD_END;
+            continue;
+        }
+
+        if (state_h_value < best_h_value)
+        {
+            best_h_value = state_h_value;
+            event_handler.on_new_best_h_value(best_h_value);
+
+            // Boost prefered queue
+            openlist_weights[0] += options.boost_preferred_queue;
+        }
+
+        const auto& preferred_actions = heuristic.get_preferred_actions();
+
+        /* Ensure that the state is closed */
+
+        search_node.status = SearchNodeStatus::CLOSED;
+
+        successor_generator.get_applicable_actions(node, applicable_actions);
+
+        if (options.shuffle_labeled_succ_nodes)
+            std::shuffle(applicable_actions.begin(), applicable_actions.end(), rng);
 
-            /* Exploration strategy */
+        /* Defer the successors: the key uses the g-value of the parent since the successors are not materialized yet. */
 
-            if (is_preferred)
-                preferred_openlist.insert(QueueEntry { succ_node.get_metric(), state_h_value, succ_state_index, step++, successor_search_node.status });
+        for (const auto action : applicable_actions)
+        {
+            const auto succ_transition = Transition<Kind> { state_index, action.get_index() };
+
+            if (preferred_actions.contains(action.get_index()))
+                preferred_openlist.insert(QueueEntry { node.get_metric(), state_h_value, succ_transition, step++ });
             else
-                standard_openlist.insert(QueueEntry { succ_node.get_metric(), state_h_value, succ_state_index, step++, successor_search_node.status });
+                standard_openlist.insert(QueueEntry { node.get_metric(), state_h_value, succ_transition, step++ });
         }
+
+        // The expanded node is the parent of the transitions inserted above.
+        parent_node.emplace(std::move(node));
     }
 
-    event_handler->on_end_search();
-    event_handler->on_exhausted();
+    event_handler.on_end_search();
+    event_handler.on_exhausted();
 
     result.status = SearchStatus::EXHAUSTED;
     return result;
 }
 
+template<TaskKind Kind>
+SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& successor_generator, Heuristic<Kind>& heuristic, const Options<Kind>& options)
+{
+    const auto event_handler = (options.event_handler) ? options.event_handler : DefaultEventHandler<Kind>::create(0);
+    const auto pruning_strategy = (options.pruning_strategy) ? options.pruning_strategy : NoPruningStrategy<Kind>::create();
+    const auto goal_strategy = (options.goal_strategy) ? options.goal_strategy : TaskGoalStrategy<Kind>::create(task);
+
+    return dispatch_search_policies<DefaultEventHandler<Kind>>(
+        heuristic,
+        *pruning_strategy,
+        *goal_strategy,
+        *event_handler,
+        [&](auto& heuristic_, auto& pruning_strategy_, auto& goal_strategy_, auto& event_handler_)
+        { return find_solution_impl(task, successor_generator, heuristic_, pruning_strategy_, goal_strategy_, event_handler_, options); });
+}
+
 template SearchResult<LiftedTag> find_solution<LiftedTag>(Task<LiftedTag>& task,
                                                           SuccessorGenerator<LiftedTag>& successor_generator,
                                                           Heuristic<LiftedTag>& heuristic,
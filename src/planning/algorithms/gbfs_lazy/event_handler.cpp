@@ -43,10 +43,10 @@ void DefaultEventHandler<Kind>::on_expand_goal_node_impl(const Node<Kind>& node)
 }
 
 template<TaskKind Kind>
-void DefaultEventHandler<Kind>::on_generate_node_impl(const LabeledNode<Kind>& labeled_succ_node) const
+void DefaultEventHandler<Kind>::on_generate_node_impl(formalism::planning::GroundActionView label, const Node<Kind>& succ_node) const
 {
-    fmt::print(std::cout, "[GBFS] Action: {}\n", labeled_succ_node.label);
-    fmt::print(std::cout, "[GBFS] Successor node: {}\n\n", labeled_succ_node.node);
+    fmt::print(std::cout, "[GBFS] Action: {}\n", label);
+    fmt::print(std::cout, "[GBFS] Successor node: {}\n\n", succ_node);
 }
 
 template<TaskKind Kind>
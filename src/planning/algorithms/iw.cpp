@@ -0,0 +1,291 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/algorithms/iw.hpp"
+
+#include "tyr/common/chrono.hpp"
+#include "tyr/common/memory.hpp"
+#include "tyr/common/segmented_vector.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/formalism/planning/views.hpp"
+#include "tyr/planning/algorithms/gbfs_lazy/event_handler.hpp"
+#include "tyr/planning/algorithms/strategies/dispatch.hpp"
+#include "tyr/planning/algorithms/strategies/goal.hpp"
+#include "tyr/planning/algorithms/strategies/pruning.hpp"
+#include "tyr/planning/algorithms/utils.hpp"
+#include "tyr/planning/applicability.hpp"
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/ground_task/node.hpp"
+#include "tyr/planning/ground_task/state_repository.hpp"
+#include "tyr/planning/ground_task/state_view.hpp"
+#include "tyr/planning/ground_task/successor_generator.hpp"
+#include "tyr/planning/ground_task/unpacked_state.hpp"
+#include "tyr/planning/lifted_task.hpp"
+#include "tyr/planning/lifted_task/node.hpp"
+#include "tyr/planning/lifted_task/state_repository.hpp"
+#include "tyr/planning/lifted_task/state_view.hpp"
+#include "tyr/planning/lifted_task/successor_generator.hpp"
+#include "tyr/planning/lifted_task/unpacked_state.hpp"
+#include "tyr/planning/novelty.hpp"
+#include "tyr/planning/search_node.hpp"
+#include "tyr/planning/search_space.hpp"
+#include "tyr/planning/state_index.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <random>
+
+namespace tyr::planning::iw
+{
+
+/**
+ * IW search node
+ */
+
+template<TaskKind Kind>
+struct SearchNode
+{
+    float_t g_value;
+    Index<State<Kind>> parent_state;
+    SearchNodeStatus status;
+};
+
+static_assert(sizeof(SearchNode<LiftedTag>) == 16);
+static_assert(sizeof(SearchNode<GroundTag>) == 16);
+
+template<TaskKind Kind>
+using SearchNodeVector = SegmentedVector<SearchNode<Kind>>;
+
+template<TaskKind Kind>
+static SearchNode<Kind>& get_or_create_search_node(Index<State<Kind>> state_index, SearchNodeVector<Kind>& search_nodes)
+{
+    static auto default_node = SearchNode { std::numeric_limits<float_t>::infinity(), Index<State<Kind>>::max(), SearchNodeStatus::NEW };
+
+    while (uint_t(state_index) >= search_nodes.size())
+    {
+        search_nodes.push_back(default_node);
+    }
+    return search_nodes[uint_t(state_index)];
+}
+
+template<TaskKind Kind, typename PruningStrategyType, typename GoalStrategyType, typename EventHandlerType>
+static SearchResult<Kind> find_solution_impl(Task<Kind>& task,
+                                             SuccessorGenerator<Kind>& successor_generator,
+                                             PruningStrategyType& pruning_strategy,
+                                             GoalStrategyType& goal_strategy,
+                                             EventHandlerType& event_handler,
+                                             const Options<Kind>& options)
+{
+    const auto start_node = (options.start_node) ? options.start_node.value() : successor_generator.get_initial_node();
+    const auto& start_state = start_node.get_state();
+    const auto start_state_index = start_state.get_index();
+    auto rng = std::mt19937_64(options.random_seed);
+    auto& state_repository = *successor_generator.get_state_repository();
+
+    auto result = SearchResult<Kind>();
+    auto search_nodes = SearchNodeVector<Kind>();
+    auto queue = std::deque<Index<State<Kind>>>();
+    auto novelty_table = NoveltyTable<Kind>(task, options.arity);
+    auto& start_search_node = get_or_create_search_node(start_state_index, search_nodes);
+    start_search_node.status = SearchNodeStatus::OPEN;
+    start_search_node.g_value = start_node.get_metric();
+
+    event_handler.on_start_search(start_node, float_t { 0 });
+
+    /* Test static goal. */
+
+    if (!goal_strategy.is_static_goal_satisfied())
+    {
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
+
+        result.status = SearchStatus::UNSOLVABLE;
+        return result;
+    }
+
+    /* Test whether initial state is goal. */
+
+    if (goal_strategy.is_dynamic_goal_satisfied(start_state))
+    {
+        event_handler.on_end_search();
+
+        result.plan = Plan(start_node, LabeledNodeList<Kind> {});
+        result.goal_node = start_node;
+        result.status = SearchStatus::SOLVED;
+
+        event_handler.on_solved(result.plan.value());
+
+        return result;
+    }
+
+    if (std::isnan(start_node.get_metric()))
+    {
+        event_handler.on_end_search();
+
+        throw std::runtime_error("find_solution(...): start node metric value is NaN.");
+    }
+
+    /* Test whether initial state should be pruned. */
+
+    if (pruning_strategy.should_prune_state(start_state))
+    {
+        event_handler.on_end_search();
+        event_handler.on_unsolvable();
+
+        result.status = SearchStatus::EXHAUSTED;
+        return result;
+    }
+
+    // The start state is novel by definition; inserting it marks its tuples as seen.
+    novelty_table.compute_novelty_and_insert(start_state);
+
+    auto labeled_succ_nodes = std::vector<LabeledNode<Kind>> {};
+
+    queue.push_back(start_state_index);
+
+    auto stopwatch = options.max_time ? std::optional<CountdownWatch>(options.max_time.value()) : std::nullopt;
+    auto memory_budget = options.max_memory ? std::optional<MemoryBudget>(options.max_memory.value()) : std::nullopt;
+
+    while (!queue.empty())
+    {
+        if (stopwatch && stopwatch->has_finished())
+        {
+            event_handler.on_end_search();
+
+            result.status = SearchStatus::OUT_OF_TIME;
+            return result;
+        }
+
+        if (memory_budget
+            && memory_budget->is_exceeded(state_repository.memory_usage() + search_nodes.memory_usage() + novelty_table.memory_usage()
+                                          + queue.size() * sizeof(Index<State<Kind>>)))
+        {
+            event_handler.on_end_search();
+
+            result.status = SearchStatus::OUT_OF_MEMORY;
+            return result;
+        }
+
+        const auto state_index = queue.front();
+
+        queue.pop_front();
+
+        auto& search_node = get_or_create_search_node(state_index, search_nodes);
+        const auto node = Node<Kind>(state_repository.get_registered_state(state_index), search_node.g_value);
+
+        /* Expand the successors of the node. */
+
+        event_handler.on_expand_node(node);
+
+        search_node.status = SearchNodeStatus::CLOSED;
+
+        successor_generator.get_labeled_successor_nodes(node, labeled_succ_nodes);
+
+        if (options.shuffle_labeled_succ_nodes)
+            std::shuffle(labeled_succ_nodes.begin(), labeled_succ_nodes.end(), rng);
+
+        for (const auto& labeled_succ_node : labeled_succ_nodes)
+        {
+            const auto& succ_node = labeled_succ_node.node;
+            const auto& succ_state = succ_node.get_state();
+            const auto succ_state_index = succ_state.get_index();
+
+            auto& successor_search_node = get_or_create_search_node(succ_state_index, search_nodes);
+
+            assert(!std::isnan(succ_node.get_metric()));
+
+            /* Skip previously generated state: breadth-first search reaches each state first with the fewest actions. */
+
+            if (successor_search_node.status != SearchNodeStatus::NEW)
+                continue;
+
+            if (search_nodes.size() >= options.max_num_states)
+            {
+                event_handler.on_end_search();
+
+                result.status = SearchStatus::OUT_OF_STATES;
+                return result;
+            }
+
+            /* Apply pruning strategy and prune states that are not novel. */
+
+            if (pruning_strategy.should_prune_successor_state(node.get_state(), succ_state, true)
+                || novelty_table.compute_novelty_and_insert(succ_state) > options.arity)
+            {
+                successor_search_node.status = SearchNodeStatus::CLOSED;
+                event_handler.on_prune_node(succ_node);
+                continue;
+            }
+
+            event_handler.on_generate_node(labeled_succ_node.label, labeled_succ_node.node);
+
+            successor_search_node.status = SearchNodeStatus::OPEN;
+            successor_search_node.parent_state = state_index;
+            successor_search_node.g_value = succ_node.get_metric();
+
+            /* Goal test on generation. */
+
+            if (goal_strategy.is_dynamic_goal_satisfied(succ_state))
+            {
+                successor_search_node.status = SearchNodeStatus::GOAL;
+
+                event_handler.on_expand_goal_node(succ_node);
+
+                event_handler.on_end_search();
+
+                result.plan = extract_total_ordered_plan(successor_search_node, succ_node, search_nodes, successor_generator);
+                result.goal_node = succ_node;
+                result.status = SearchStatus::SOLVED;
+
+                event_handler.on_solved(result.plan.value());
+
+                return result;
+            }
+
+            queue.push_back(succ_state_index);
+        }
+    }
+
+    event_handler.on_end_search();
+    event_handler.on_exhausted();
+
+    result.status = SearchStatus::EXHAUSTED;
+    return result;
+}
+
+template<TaskKind Kind>
+SearchResult<Kind> find_solution(Task<Kind>& task, SuccessorGenerator<Kind>& successor_generator, const Options<Kind>& options)
+{
+    const auto event_handler = (options.event_handler) ? options.event_handler : gbfs_lazy::DefaultEventHandler<Kind>::create(0);
+    const auto pruning_strategy = (options.pruning_strategy) ? options.pruning_strategy : NoPruningStrategy<Kind>::create();
+    const auto goal_strategy = (options.goal_strategy) ? options.goal_strategy : TaskGoalStrategy<Kind>::create(task);
+
+    return dispatch_search_policies<gbfs_lazy::DefaultEventHandler<Kind>>(
+        *pruning_strategy,
+        *goal_strategy,
+        *event_handler,
+        [&](auto& pruning_strategy_, auto& goal_strategy_, auto& event_handler_)
+        { return find_solution_impl(task, successor_generator, pruning_strategy_, goal_strategy_, event_handler_, options); });
+}
+
+template SearchResult<LiftedTag>
+find_solution<LiftedTag>(Task<LiftedTag>& task, SuccessorGenerator<LiftedTag>& successor_generator, const Options<LiftedTag>& options);
+
+template SearchResult<GroundTag>
+find_solution<GroundTag>(Task<GroundTag>& task, SuccessorGenerator<GroundTag>& successor_generator, const Options<GroundTag>& options);
+
+}
@@ -34,11 +34,14 @@ namespace fp = tyr::formalism::planning;
 namespace tyr::planning
 {
 
-Task<GroundTag>::Task(formalism::planning::PlanningFDRTask task) :
+Task<GroundTag>::Task(formalism::planning::PlanningFDRTask task, ActionMatcherKind action_matcher) :
     m_task(std::move(task)),
     m_static_atoms_bitset(),
     m_static_numeric_variables(),
-    m_action_match_tree(match_tree::MatchTree<fp::GroundAction>::create(get_task().get_ground_actions().get_data(), get_task().get_context())),
+    m_action_match_tree(),
+    m_action_bitset_matcher(),
+    m_action_table(),
+    m_axiom_strata(compute_ground_axiom_stratification(get_task())),
     m_axiom_match_tree_strata()
 {
     for (const auto atom : get_task().template get_atoms<f::StaticTag>())
@@ -47,10 +50,22 @@ Task<GroundTag>::Task(formalism::planning::PlanningFDRTask task) :
     for (const auto fterm_value : get_task().template get_fterm_values<f::StaticTag>())
         set(uint_t(fterm_value.get_fterm().get_index()), fterm_value.get_value(), m_static_numeric_variables, std::numeric_limits<float_t>::quiet_NaN());
 
-    auto axiom_strata = compute_ground_axiom_stratification(get_task());
+    m_action_table = GroundActionTable(get_task().get_ground_actions(), m_static_atoms_bitset);
 
-    for (const auto& stratum : axiom_strata.data)
-        m_axiom_match_tree_strata.emplace_back(match_tree::MatchTree<fp::GroundAxiom>::create(stratum, get_task().get_context()));
+    const auto& actions = get_task().get_ground_actions().get_data();
+    if (action_matcher == ActionMatcherKind::AUTOMATIC)
+        action_matcher =
+            BitsetMatcher<fp::GroundAction>::is_preferred(actions, get_task().get_context()) ? ActionMatcherKind::BITSET : ActionMatcherKind::MATCH_TREE;
+
+    if (action_matcher == ActionMatcherKind::BITSET)
+        m_action_bitset_matcher = BitsetMatcher<fp::GroundAction>::create(actions, get_task().get_context());
+    else
+        m_action_match_tree = match_tree::MatchTree<fp::GroundAction>::create(actions, get_task().get_context());
+
+    // Recursive strata are evaluated with precondition counters and need no match tree.
+    for (uint_t s = 0; s < m_axiom_strata.data.size(); ++s)
+        m_axiom_match_tree_strata.emplace_back(
+            m_axiom_strata.is_recursive[s] ? nullptr : match_tree::MatchTree<fp::GroundAxiom>::create(m_axiom_strata.data[s], get_task().get_context()));
 }
 
 template<f::FactKind T>
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/ground_task/action_table.hpp"
+
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/formalism/planning/views.hpp"
+#include "tyr/planning/applicability.hpp"
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/ground_task/unpacked_state.hpp"
+#include "tyr/planning/numeric_bytecode.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::planning
+{
+
+GroundActionTable::GroundActionTable(fp::GroundActionListView actions, const boost::dynamic_bitset<>& static_atoms) :
+    m_row_by_action(),
+    m_effect_offsets(),
+    m_fact_offsets(),
+    m_derived_offsets(),
+    m_constraint_offsets(),
+    m_numeric_effect_offsets(),
+    m_has_auxiliary_numeric_effect(),
+    m_auxiliary_numeric_effects(),
+    m_fact_variables(),
+    m_fact_values(),
+    m_derived_atoms(),
+    m_derived_polarities(),
+    m_constraints(),
+    m_numeric_effect_fterms(),
+    m_numeric_effect_values(),
+    m_bytecode()
+{
+    const auto push_facts = [&](auto facts)
+    {
+        for (const auto fact : facts)
+        {
+            m_fact_variables.push_back(fact.get_data().variable);
+            m_fact_values.push_back(fact.get_data().value);
+        }
+    };
+
+    m_effect_offsets.push_back(0);
+    m_derived_offsets.push_back(0);
+    m_constraint_offsets.push_back(0);
+    m_numeric_effect_offsets.push_back(0);
+
+    for (uint_t row = 0; row < actions.size(); ++row)
+    {
+        const auto action = actions[row];
+
+        if (uint_t(action.get_index()) >= m_row_by_action.size())
+            m_row_by_action.resize(uint_t(action.get_index()) + 1, NO_ROW);
+        m_row_by_action[uint_t(action.get_index())] = row;
+
+        for (const auto cond_effect : action.get_effects())
+        {
+            const auto condition = cond_effect.get_condition();
+            const auto effect = cond_effect.get_effect();
+
+            if (!is_statically_applicable(condition, static_atoms))
+                continue;  ///< never fires
+
+            m_fact_offsets.push_back(m_fact_variables.size());
+            push_facts(condition.template get_facts<f::PositiveTag>());
+            m_fact_offsets.push_back(m_fact_variables.size());
+            push_facts(condition.template get_facts<f::NegativeTag>());
+            m_fact_offsets.push_back(m_fact_variables.size());
+            push_facts(effect.template get_facts<f::NegativeTag>());
+            m_fact_offsets.push_back(m_fact_variables.size());
+            push_facts(effect.template get_facts<f::PositiveTag>());
+
+            for (const auto literal : condition.template get_literals<f::DerivedTag>())
+            {
+                m_derived_atoms.push_back(literal.get_atom().get_index());
+                m_derived_polarities.push_back(literal.get_polarity());
+            }
+            m_derived_offsets.push_back(m_derived_atoms.size());
+
+            for (const auto constraint : condition.get_numeric_constraints())
+                m_constraints.push_back(compile(constraint, m_bytecode));
+            m_constraint_offsets.push_back(m_constraints.size());
+
+            for (const auto numeric_effect : effect.get_numeric_effects())
+            {
+                visit([&](auto&& arg) { m_numeric_effect_fterms.push_back(arg.get_fterm().get_index()); }, numeric_effect.get_variant());
+                m_numeric_effect_values.push_back(compile(numeric_effect, m_bytecode));
+            }
+            m_numeric_effect_offsets.push_back(m_numeric_effect_values.size());
+
+            const auto auxiliary_numeric_effect = effect.get_auxiliary_numeric_effect();
+            m_has_auxiliary_numeric_effect.push_back(auxiliary_numeric_effect.has_value());
+            m_auxiliary_numeric_effects.push_back(auxiliary_numeric_effect.has_value() ? compile(auxiliary_numeric_effect.value(), m_bytecode) :
+                                                                                         formalism::NumericExpressionCode {});
+        }
+
+        m_effect_offsets.push_back(m_has_auxiliary_numeric_effect.size());
+    }
+
+    // Sentinel such that the add effects of the last conditional effect end at the total number of facts.
+    m_fact_offsets.push_back(m_fact_variables.size());
+}
+
+bool GroundActionTable::is_applicable(uint_t effect, const StateContext<GroundTag>& state_context) const
+{
+    const auto& state = state_context.unpacked_state;
+    const auto* offsets = m_fact_offsets.data() + NUM_SEGMENTS * effect;
+
+    for (auto i = offsets[POSITIVE_CONDITION]; i < offsets[NEGATIVE_CONDITION]; ++i)
+        if (state.get(m_fact_variables[i]) != m_fact_values[i])
+            return false;
+
+    for (auto i = offsets[NEGATIVE_CONDITION]; i < offsets[DEL_EFFECT]; ++i)
+        if (state.get(m_fact_variables[i]) == m_fact_values[i])
+            return false;
+
+    for (auto i = m_derived_offsets[effect]; i < m_derived_offsets[effect + 1]; ++i)
+        if (state.test(m_derived_atoms[i]) != bool(m_derived_polarities[i]))
+            return false;
+
+    for (auto i = m_constraint_offsets[effect]; i < m_constraint_offsets[effect + 1]; ++i)
+        if (!tyr::planning::is_applicable(m_bytecode, m_constraints[i], state_context))
+            return false;
+
+    return true;
+}
+
+void GroundActionTable::apply(Index<fp::GroundAction> action,
+                              StateContext<GroundTag>& state_context,
+                              UnpackedState<GroundTag>& succ_unpacked_state,
+                              DataList<fp::FDRFact<f::FluentTag>>& out_del_effects,
+                              DataList<fp::FDRFact<f::FluentTag>>& out_add_effects) const
+{
+    assert(contains(action));
+
+    const auto row = m_row_by_action[uint_t(action)];
+
+    for (auto effect = m_effect_offsets[row]; effect < m_effect_offsets[row + 1]; ++effect)
+    {
+        if (!is_applicable(effect, state_context))
+            continue;
+
+        const auto* offsets = m_fact_offsets.data() + NUM_SEGMENTS * effect;
+
+        for (auto i = offsets[DEL_EFFECT]; i < offsets[ADD_EFFECT]; ++i)
+            out_del_effects.emplace_back(m_fact_variables[i], m_fact_values[i]);
+
+        for (auto i = offsets[ADD_EFFECT]; i < offsets[NUM_SEGMENTS]; ++i)
+            out_add_effects.emplace_back(m_fact_variables[i], m_fact_values[i]);
+
+        for (auto i = m_numeric_effect_offsets[effect]; i < m_numeric_effect_offsets[effect + 1]; ++i)
+            succ_unpacked_state.set(m_numeric_effect_fterms[i], evaluate(m_bytecode, m_numeric_effect_values[i], state_context));
+
+        /// Collect the increment (total-cost) in the state_context
+        if (m_has_auxiliary_numeric_effect[effect])
+            state_context.auxiliary_value = evaluate(m_bytecode, m_auxiliary_numeric_effects[effect], state_context);
+    }
+}
+
+size_t GroundActionTable::memory_usage() const noexcept
+{
+    return m_row_by_action.capacity() * sizeof(uint_t) + m_effect_offsets.capacity() * sizeof(uint_t) + m_fact_offsets.capacity() * sizeof(uint_t)
+           + m_derived_offsets.capacity() * sizeof(uint_t) + m_constraint_offsets.capacity() * sizeof(uint_t)
+           + m_numeric_effect_offsets.capacity() * sizeof(uint_t) + m_has_auxiliary_numeric_effect.capacity() * sizeof(uint8_t)
+           + m_auxiliary_numeric_effects.capacity() * sizeof(formalism::NumericExpressionCode)
+           + m_fact_variables.capacity() * sizeof(Index<fp::FDRVariable<f::FluentTag>>) + m_fact_values.capacity() * sizeof(fp::FDRValue)
+           + m_derived_atoms.capacity() * sizeof(Index<fp::GroundAtom<f::DerivedTag>>) + m_derived_polarities.capacity() * sizeof(uint8_t)
+           + m_constraints.capacity() * sizeof(formalism::NumericConstraintCode)
+           + m_numeric_effect_fterms.capacity() * sizeof(Index<fp::GroundFunctionTerm<f::FluentTag>>)
+           + m_numeric_effect_values.capacity() * sizeof(formalism::NumericExpressionCode) + m_bytecode.memory_usage();
+}
+
+}
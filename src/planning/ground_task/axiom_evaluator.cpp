@@ -26,42 +26,159 @@
 #include "tyr/planning/ground_task/match_tree/match_tree.hpp"
 #include "tyr/planning/ground_task/unpacked_state.hpp"
 
+#include <cassert>
+
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+
 namespace tyr::planning
 {
 
-AxiomEvaluator<GroundTag>::AxiomEvaluator(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr) : m_task(task), m_applicable_axioms() {}
+AxiomEvaluator<GroundTag>::AxiomEvaluator(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr) :
+    m_task(task),
+    m_recursive_strata(),
+    m_applicable_axioms(),
+    m_counters(),
+    m_is_base_applicable(),
+    m_queue()
+{
+    const auto& strata = m_task->get_axiom_strata();
+
+    for (uint_t s = 0; s < strata.data.size(); ++s)
+    {
+        if (!strata.is_recursive[s])
+        {
+            m_recursive_strata.push_back(std::nullopt);
+            continue;
+        }
+
+        const auto& axioms = strata.data[s];
+
+        auto heads = UnorderedSet<Index<fp::GroundAtom<f::DerivedTag>>> {};
+        for (const auto axiom : make_view(axioms, *m_task->get_repository()))
+            heads.insert(axiom.get_head().get_index());
+
+        auto stratum = RecursiveStratum { axioms, {}, {}, {} };
+
+        for (uint_t i = 0; i < axioms.size(); ++i)
+        {
+            const auto axiom = make_view(axioms[i], *m_task->get_repository());
+
+            auto& base_derived_literals = stratum.base_derived_literals.emplace_back();
+            auto& num_recursive_preconditions = stratum.num_recursive_preconditions.emplace_back(0);
+
+            for (const auto literal : axiom.get_body().get_literals<f::DerivedTag>())
+            {
+                if (literal.get_polarity() && heads.contains(literal.get_atom().get_index()))
+                {
+                    stratum.axioms_by_recursive_atom[literal.get_atom().get_index()].push_back(i);
+                    ++num_recursive_preconditions;
+                }
+                else
+                {
+                    base_derived_literals.push_back(literal.get_index());
+                }
+            }
+        }
+
+        m_recursive_strata.push_back(std::move(stratum));
+    }
+}
 
 std::shared_ptr<AxiomEvaluator<GroundTag>> AxiomEvaluator<GroundTag>::create(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context)
 {
     return std::make_shared<AxiomEvaluator<GroundTag>>(std::move(task), std::move(execution_context));
 }
 
-void AxiomEvaluator<GroundTag>::compute_extended_state(UnpackedState<GroundTag>& unpacked_state)
+bool AxiomEvaluator<GroundTag>::is_base_applicable(const RecursiveStratum& stratum, uint_t axiom, const StateContext<GroundTag>& state_context) const
+{
+    const auto& repository = *m_task->get_repository();
+    const auto body = make_view(stratum.axioms[axiom], repository).get_body();
+
+    // Static literals hold by construction of the ground task.
+    return is_applicable<f::PositiveTag>(body.get_facts<f::PositiveTag>(), state_context)
+           && is_applicable<f::NegativeTag>(body.get_facts<f::NegativeTag>(), state_context)
+           && is_applicable(make_view(stratum.base_derived_literals[axiom], repository), state_context)
+           && is_applicable(body.get_numeric_constraints(), state_context);
+}
+
+void AxiomEvaluator<GroundTag>::evaluate_recursive_stratum(const RecursiveStratum& stratum, UnpackedState<GroundTag>& unpacked_state)
 {
+    const auto& repository = *m_task->get_repository();
     auto state_context = StateContext<GroundTag> { *m_task, unpacked_state, float_t(0) };
 
-    for (const auto& match_tree : m_task->get_axiom_match_tree_strata())
+    m_counters.assign(stratum.num_recursive_preconditions.begin(), stratum.num_recursive_preconditions.end());
+    m_is_base_applicable.clear();
+    m_is_base_applicable.resize(stratum.axioms.size(), false);
+    m_queue.clear();
+
+    const auto fire = [&](uint_t axiom)
     {
-        while (true)
+        const auto atom = make_view(stratum.axioms[axiom], repository).get_head().get_index();
+
+        if (!unpacked_state.test(atom))
         {
-            auto discovered_new_atom = bool { false };
+            unpacked_state.set(atom);
+            m_queue.push_back(atom);
+        }
+    };
 
-            m_applicable_axioms.clear();
-            match_tree->generate(state_context, m_applicable_axioms);
+    // Atoms of this stratum can only be true before its evaluation if the state was extended already.
+    for (const auto& [atom, axioms] : stratum.axioms_by_recursive_atom)
+        if (unpacked_state.test(atom))
+            m_queue.push_back(atom);
 
-            for (const auto axiom : m_applicable_axioms)
-            {
-                const auto atom = make_view(axiom, *m_task->get_repository()).get_head().get_index();
+    for (uint_t i = 0; i < stratum.axioms.size(); ++i)
+    {
+        if (!is_base_applicable(stratum, i, state_context))
+            continue;
+
+        m_is_base_applicable.set(i);
 
-                if (!unpacked_state.test(atom))
-                    discovered_new_atom = true;
+        if (m_counters[i] == 0)
+            fire(i);
+    }
 
-                unpacked_state.set(atom);
+    while (!m_queue.empty())
+    {
+        const auto atom = m_queue.back();
+        m_queue.pop_back();
+
+        if (const auto it = stratum.axioms_by_recursive_atom.find(atom); it != stratum.axioms_by_recursive_atom.end())
+        {
+            for (const auto axiom : it->second)
+            {
+                assert(m_counters[axiom] > 0);
+
+                if (--m_counters[axiom] == 0 && m_is_base_applicable.test(axiom))
+                    fire(axiom);
             }
+        }
+    }
+}
+
+void AxiomEvaluator<GroundTag>::compute_extended_state(UnpackedState<GroundTag>& unpacked_state)
+{
+    auto state_context = StateContext<GroundTag> { *m_task, unpacked_state, float_t(0) };
 
-            if (!discovered_new_atom)
-                break;
+    const auto& match_tree_strata = m_task->get_axiom_match_tree_strata();
+
+    for (uint_t s = 0; s < match_tree_strata.size(); ++s)
+    {
+        if (m_recursive_strata[s])
+        {
+            evaluate_recursive_stratum(*m_recursive_strata[s], unpacked_state);
+            continue;
         }
+
+        assert(match_tree_strata[s]);
+
+        // Without recursion, the applicable axioms do not depend on the atoms derived in this stratum.
+        m_applicable_axioms.clear();
+        match_tree_strata[s]->generate(state_context, m_applicable_axioms);
+
+        for (const auto axiom : m_applicable_axioms)
+            unpacked_state.set(make_view(axiom, *m_task->get_repository()).get_head().get_index());
     }
 }
 
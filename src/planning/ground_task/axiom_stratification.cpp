@@ -80,10 +80,30 @@ GroundAxiomStrata compute_ground_axiom_stratification(fp::FDRTaskView task)
     for (const auto axiom : task.get_ground_axioms())
         buckets[atom_stratum[uint_t(axiom.get_head().get_index())]].push_back(axiom.get_index());
 
+    // 7) Mark strata whose axioms depend positively on heads of the same stratum
+    auto is_head = std::vector<bool>(num_atoms, false);
+    for (const auto axiom : task.get_ground_axioms())
+        is_head[uint_t(axiom.get_head().get_index())] = true;
+
+    auto is_recursive = std::vector<bool>(buckets.size(), false);
+    for (const auto axiom : task.get_ground_axioms())
+    {
+        const auto h_stratum = atom_stratum[uint_t(axiom.get_head().get_index())];
+
+        for (const auto literal : axiom.get_body().get_literals<f::DerivedTag>())
+        {
+            const auto b_atom = uint_t(literal.get_atom().get_index());
+
+            if (literal.get_polarity() && is_head[b_atom] && atom_stratum[b_atom] == h_stratum)
+                is_recursive[h_stratum] = true;
+        }
+    }
+
     auto out = GroundAxiomStrata {};
     out.data.reserve(buckets.size());
     for (auto& b : buckets)
         out.data.emplace_back(GroundAxiomStratum(std::move(b)));
+    out.is_recursive = std::move(is_recursive);
 
     return out;
 }
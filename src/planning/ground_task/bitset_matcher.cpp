@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/ground_task/bitset_matcher.hpp"
+
+#include "tyr/common/types.hpp"
+#include "tyr/formalism/planning/declarations.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/formalism/planning/views.hpp"
+#include "tyr/planning/applicability.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/ground_task/unpacked_state.hpp"
+#include "tyr/planning/numeric_bytecode.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <limits>
+
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::planning
+{
+
+namespace
+{
+constexpr size_t bits_per_block = std::numeric_limits<uint64_t>::digits;
+
+constexpr size_t num_blocks(size_t num_bits) { return (num_bits + bits_per_block - 1) / bits_per_block; }
+
+inline auto get_condition(fp::GroundActionView el) { return el.get_condition(); }
+
+/// @brief The keys that select a bitset during evaluation, in order of first occurrence.
+struct Keys
+{
+    std::vector<std::pair<Index<fp::FDRVariable<f::FluentTag>>, size_t>> variables;  ///< with domain size
+    std::vector<Index<fp::GroundAtom<f::DerivedTag>>> derived_atoms;
+    size_t num_preconditions = 0;
+
+    size_t num_bitsets() const noexcept
+    {
+        auto result = 2 * derived_atoms.size();
+        for (const auto& [variable, domain_size] : variables)
+            result += domain_size;
+        return result;
+    }
+};
+
+template<typename Tag>
+Keys collect_keys(const IndexList<Tag>& elements, const fp::Repository& context)
+{
+    auto keys = Keys {};
+    auto variables = UnorderedSet<Index<fp::FDRVariable<f::FluentTag>>> {};
+    auto derived_atoms = UnorderedSet<Index<fp::GroundAtom<f::DerivedTag>>> {};
+
+    const auto add_variable = [&](auto variable)
+    {
+        if (variables.insert(variable.get_index()).second)
+            keys.variables.emplace_back(variable.get_index(), variable.get_domain_size());
+    };
+
+    for (const auto element : elements)
+    {
+        const auto condition = get_condition(make_view(element, context));
+
+        for (const auto fact : condition.template get_facts<f::PositiveTag>())
+            add_variable(fact.get_variable());
+
+        for (const auto fact : condition.template get_facts<f::NegativeTag>())
+            add_variable(fact.get_variable());
+
+        for (const auto literal : condition.template get_literals<f::DerivedTag>())
+            if (derived_atoms.insert(literal.get_atom().get_index()).second)
+                keys.derived_atoms.push_back(literal.get_atom().get_index());
+
+        keys.num_preconditions += condition.template get_facts<f::PositiveTag>().size() + condition.template get_facts<f::NegativeTag>().size()
+                                  + condition.template get_literals<f::DerivedTag>().size();
+    }
+
+    return keys;
+}
+
+}
+
+template<typename Tag>
+BitsetMatcher<Tag>::BitsetMatcher(IndexList<Tag> elements_, const fp::Repository& context_) :
+    m_elements(std::move(elements_)),
+    m_context(context_),
+    m_num_blocks(num_blocks(m_elements.size())),
+    m_blocks(),
+    m_variable_offsets(),
+    m_derived_offsets(),
+    m_constrained(m_num_blocks, Block(0)),
+    m_constraint_offsets(1, 0),
+    m_constraints(),
+    m_bytecode(),
+    m_applicable(m_num_blocks, Block(0))
+{
+    const auto keys = collect_keys(m_elements, m_context);
+
+    // Every bitset starts with all elements being compatible.
+    m_blocks.assign(keys.num_bitsets() * m_num_blocks, ~Block(0));
+
+    auto variable_offsets = UnorderedMap<Index<fp::FDRVariable<f::FluentTag>>, size_t> {};
+    auto derived_offsets = UnorderedMap<Index<fp::GroundAtom<f::DerivedTag>>, size_t> {};
+    auto offset = size_t(0);
+
+    for (const auto& [variable, domain_size] : keys.variables)
+    {
+        m_variable_offsets.emplace_back(variable, offset);
+        variable_offsets.emplace(variable, offset);
+        offset += domain_size * m_num_blocks;
+    }
+    for (const auto atom : keys.derived_atoms)
+    {
+        m_derived_offsets.emplace_back(atom, offset);
+        derived_offsets.emplace(atom, offset);
+        offset += 2 * m_num_blocks;
+    }
+    assert(offset == m_blocks.size());
+
+    const auto reset = [&](size_t bitset_offset, size_t pos)
+    { m_blocks[bitset_offset + pos / bits_per_block] &= ~(Block(1) << (pos % bits_per_block)); };
+
+    for (size_t pos = 0; pos < m_elements.size(); ++pos)
+    {
+        const auto condition = get_condition(make_view(m_elements[pos], m_context));
+
+        // v = x is incompatible with every other value of v.
+        for (const auto fact : condition.template get_facts<f::PositiveTag>())
+        {
+            const auto variable = fact.get_variable();
+            const auto variable_offset = variable_offsets.at(variable.get_index());
+            for (uint_t value = 0; value < variable.get_domain_size(); ++value)
+                if (value != uint_t(fact.get_value()))
+                    reset(variable_offset + value * m_num_blocks, pos);
+        }
+
+        // v != x is incompatible with x.
+        for (const auto fact : condition.template get_facts<f::NegativeTag>())
+            reset(variable_offsets.at(fact.get_variable().get_index()) + uint_t(fact.get_value()) * m_num_blocks, pos);
+
+        // The bitset of an atom at offset 0 is selected if the atom is false, at offset 1 if it is true.
+        for (const auto literal : condition.template get_literals<f::DerivedTag>())
+            reset(derived_offsets.at(literal.get_atom().get_index()) + (literal.get_polarity() ? 0 : m_num_blocks), pos);
+
+        if (!condition.get_numeric_constraints().empty())
+            m_constrained[pos / bits_per_block] |= Block(1) << (pos % bits_per_block);
+
+        for (const auto constraint : condition.get_numeric_constraints())
+            m_constraints.push_back(compile(constraint, m_bytecode));
+        m_constraint_offsets.push_back(m_constraints.size());
+    }
+}
+
+template<typename Tag>
+std::unique_ptr<BitsetMatcher<Tag>> BitsetMatcher<Tag>::create(IndexList<Tag> elements, const fp::Repository& context)
+{
+    return std::make_unique<BitsetMatcher<Tag>>(std::move(elements), context);
+}
+
+template<typename Tag>
+bool BitsetMatcher<Tag>::is_preferred(const IndexList<Tag>& elements, const fp::Repository& context)
+{
+    /// Allow the bitsets to use at most this many blocks per precondition.
+    static constexpr size_t max_blocks_per_precondition = 16;
+
+    const auto keys = collect_keys(elements, context);
+    const auto blocks_per_bitset = num_blocks(elements.size());
+    const auto blocks_per_state = (keys.variables.size() + keys.derived_atoms.size()) * blocks_per_bitset;
+
+    return blocks_per_state <= keys.num_preconditions && keys.num_bitsets() * blocks_per_bitset <= max_blocks_per_precondition * keys.num_preconditions;
+}
+
+template<typename Tag>
+void BitsetMatcher<Tag>::generate(const StateContext<GroundTag>& state, IndexList<Tag>& out_applicable_elements)
+{
+    out_applicable_elements.clear();
+
+    if (m_elements.empty())
+        return;
+
+    std::fill(m_applicable.begin(), m_applicable.end(), ~Block(0));
+    if (const auto remainder = m_elements.size() % bits_per_block)
+        m_applicable.back() = (Block(1) << remainder) - 1;
+
+    // Plain word-wise conjunction over contiguous blocks, which compilers vectorize.
+    const auto intersect = [&](const Block* bitset)
+    {
+        for (size_t i = 0; i < m_num_blocks; ++i)
+            m_applicable[i] &= bitset[i];
+    };
+
+    for (const auto& [variable, offset] : m_variable_offsets)
+        intersect(m_blocks.data() + offset + uint_t(state.unpacked_state.get(variable)) * m_num_blocks);
+
+    for (const auto& [atom, offset] : m_derived_offsets)
+        intersect(m_blocks.data() + offset + (state.unpacked_state.test(atom) ? m_num_blocks : 0));
+
+    for (size_t i = 0; i < m_num_blocks; ++i)
+    {
+        auto block = m_applicable[i];
+        while (block)
+        {
+            const auto bit = static_cast<size_t>(std::countr_zero(block));
+            block &= block - 1;
+
+            const auto pos = i * bits_per_block + bit;
+            const auto element = m_elements[pos];
+
+            if ((m_constrained[i] >> bit) & 1)
+            {
+                const auto first = m_constraints.begin() + m_constraint_offsets[pos];
+                const auto last = m_constraints.begin() + m_constraint_offsets[pos + 1];
+                if (!std::all_of(first, last, [&](auto&& constraint) { return is_applicable(m_bytecode, constraint, state); }))
+                    continue;
+            }
+
+            out_applicable_elements.push_back(element);
+        }
+    }
+}
+
+template class BitsetMatcher<fp::GroundAction>;
+
+}
@@ -35,6 +35,7 @@
 #include "tyr/planning/ground_task/match_tree/nodes/variable_view.hpp"
 #include "tyr/planning/ground_task/match_tree/repository.hpp"
 #include "tyr/planning/ground_task/unpacked_state.hpp"
+#include "tyr/planning/numeric_bytecode.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -634,7 +635,9 @@ MatchTree<Tag>::MatchTree(IndexList<Tag> elements_, const formalism::planning::R
     m_elements(std::move(elements_)),
     m_context(std::make_unique<Repository<Tag>>(uint_t(0), context_)),  // we use constant index 0 since we dont compare node views anyway.
     m_root(),
-    m_evaluate_stack()
+    m_evaluate_stack(),
+    m_bytecode(),
+    m_constraint_codes()
 {
     auto occurences = PreconditionOccurences<Tag> {};
     auto details = PreconditionDetails<Tag> {};
@@ -742,6 +745,12 @@ MatchTree<Tag>::MatchTree(IndexList<Tag> elements_, const formalism::planning::R
     }
 
     // std::cout << "Num nodes: " << num_nodes << std::endl;
+
+    // Compile the constraint of every constraint node up front, such that generate does not modify the bytecode.
+    const auto num_constraint_nodes = m_context->template size<NumericConstraintSelectorNode<Tag>>();
+    m_constraint_codes.reserve(num_constraint_nodes);
+    for (uint_t i = 0; i < num_constraint_nodes; ++i)
+        m_constraint_codes.push_back(compile(make_view(Index<NumericConstraintSelectorNode<Tag>>(i), *m_context).get_constraint(), m_bytecode));
 }
 
 template<typename Tag>
@@ -787,9 +796,10 @@ void MatchTree<Tag>::generate(const StateContext<GroundTag>& state, IndexList<Ta
                 }
                 else if constexpr (std::is_same_v<Alternative, Index<NumericConstraintSelectorNode<Tag>>>)
                 {
-                    const auto view = make_view(arg, *m_context);
-                    const auto& data = view.get_data();
-                    const auto holds = evaluate(view.get_constraint(), state);
+                    const auto& data = make_view(arg, *m_context).get_data();
+
+                    assert(uint_t(arg) < m_constraint_codes.size());
+                    const auto holds = is_applicable(m_bytecode, m_constraint_codes[uint_t(arg)], state);
 
                     if (holds && data.true_child)
                         m_evaluate_stack.push_back(data.true_child.value());
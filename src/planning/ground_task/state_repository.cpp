@@ -39,10 +39,25 @@ namespace fp = tyr::formalism::planning;
 
 namespace tyr::planning
 {
+namespace
+{
+template<typename Tag>
+StateStorageContext<GroundTag, Tag> create_state_storage_context(const Task<GroundTag>& task, [[maybe_unused]] const StateStorageOptions& options)
+{
+    if constexpr (std::same_as<Tag, Dynamic>)
+        return StateStorageContext<GroundTag, Tag>(task, options);
+    else if constexpr (std::is_constructible_v<StateStorageContext<GroundTag, Tag>, const Task<GroundTag>&>)
+        return StateStorageContext<GroundTag, Tag>(task);
+    else
+        return StateStorageContext<GroundTag, Tag>();
+}
+}
 
-StateRepository<GroundTag>::StateRepository(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context) :
+StateRepository<GroundTag>::StateRepository(std::shared_ptr<Task<GroundTag>> task,
+                                            ExecutionContextPtr execution_context,
+                                            StateStorageOptions storage_options) :
     m_task(task),
-    m_context(*m_task),
+    m_context(create_state_storage_context<StateStoragePolicyTag>(*m_task, storage_options)),
     m_fluent_backend(m_context),
     m_derived_backend(m_context),
     m_numeric_backend(m_context),
@@ -52,9 +67,10 @@ StateRepository<GroundTag>::StateRepository(std::shared_ptr<Task<GroundTag>> tas
 {
 }
 
-std::shared_ptr<StateRepository<GroundTag>> StateRepository<GroundTag>::create(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context)
+std::shared_ptr<StateRepository<GroundTag>>
+StateRepository<GroundTag>::create(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context, StateStorageOptions storage_options)
 {
-    return std::make_shared<StateRepository<GroundTag>>(std::move(task), std::move(execution_context));
+    return std::make_shared<StateRepository<GroundTag>>(std::move(task), std::move(execution_context), storage_options);
 }
 
 StateView<GroundTag> StateRepository<GroundTag>::get_initial_state()
@@ -133,9 +149,40 @@ StateView<GroundTag> StateRepository<GroundTag>::register_state(SharedObjectPool
                                                   m_numeric_backend.insert(state->get_numeric_variables())))
                    .first);
 
+#if defined(TYR_STATE_STORAGE_DYNAMIC)
+    if (m_context.requires_migration())
+        migrate_state_storage();
+#endif
+
     return StateView<GroundTag>(shared_from_this(), std::move(state));
 }
 
+#if defined(TYR_STATE_STORAGE_DYNAMIC)
+void StateRepository<GroundTag>::migrate_state_storage()
+{
+    m_context.begin_migration();
+
+    auto buffer = get_unregistered_state();
+    auto migrated_states = IndexedHashSet<State<GroundTag>>();
+
+    for (uint_t i = 0; i < m_packed_states.size(); ++i)
+    {
+        const auto& packed_state = m_packed_states[Index<State<GroundTag>>(i)];
+
+        [[maybe_unused]] const auto [index, inserted] = migrated_states.insert(
+            Data<State<GroundTag>>(Index<State<GroundTag>>(i),
+                                   m_fluent_backend.migrate(packed_state.template get_atoms<f::FluentTag>(), buffer->template get_atoms<f::FluentTag>()),
+                                   m_derived_backend.migrate(packed_state.template get_atoms<f::DerivedTag>(), buffer->template get_atoms<f::DerivedTag>()),
+                                   m_numeric_backend.migrate(packed_state.get_numeric_variables(), buffer->get_numeric_variables())));
+        assert(inserted && uint_t(index) == i);
+    }
+
+    m_packed_states = std::move(migrated_states);
+
+    m_context.end_migration();
+}
+#endif
+
 size_t StateRepository<GroundTag>::memory_usage() const noexcept
 {
     size_t bytes = 0;
@@ -28,6 +28,7 @@
 #include "tyr/planning/ground_task/state_repository.hpp"
 #include "tyr/planning/ground_task/state_view.hpp"
 #include "tyr/planning/ground_task/unpacked_state.hpp"
+#include "tyr/planning/state_handle.hpp"
 #include "tyr/planning/state_index.hpp"
 #include "tyr/planning/task_utils.hpp"
 
@@ -36,18 +37,21 @@ namespace fp = tyr::formalism::planning;
 namespace tyr::planning
 {
 
-SuccessorGenerator<GroundTag>::SuccessorGenerator(std::shared_ptr<Task<GroundTag>> task, ExecutionContextPtr execution_context) :
+SuccessorGenerator<GroundTag>::SuccessorGenerator(std::shared_ptr<Task<GroundTag>> task,
+                                                  ExecutionContextPtr execution_context,
+                                                  StateStorageOptions storage_options) :
     m_task(task),
     m_applicable_actions(),
-    m_state_repository(std::make_shared<StateRepository<GroundTag>>(task, execution_context)),
+    m_state_repository(std::make_shared<StateRepository<GroundTag>>(task, execution_context, storage_options)),
     m_executor()
 {
 }
 
 std::shared_ptr<SuccessorGenerator<GroundTag>> SuccessorGenerator<GroundTag>::create(std::shared_ptr<Task<GroundTag>> task,
-                                                                                     ExecutionContextPtr execution_context)
+                                                                                     ExecutionContextPtr execution_context,
+                                                                                     StateStorageOptions storage_options)
 {
-    return std::make_shared<SuccessorGenerator<GroundTag>>(std::move(task), std::move(execution_context));
+    return std::make_shared<SuccessorGenerator<GroundTag>>(std::move(task), std::move(execution_context), storage_options);
 }
 
 Node<GroundTag> SuccessorGenerator<GroundTag>::get_initial_node()
@@ -61,6 +65,14 @@ Node<GroundTag> SuccessorGenerator<GroundTag>::get_initial_node()
     return Node<GroundTag>(std::move(initial_state), state_metric);
 }
 
+void SuccessorGenerator<GroundTag>::generate_applicable_actions(const StateContext<GroundTag>& state_context)
+{
+    if (m_task->get_action_bitset_matcher())
+        m_task->get_action_bitset_matcher()->generate(state_context, m_applicable_actions);
+    else
+        m_task->get_action_match_tree()->generate(state_context, m_applicable_actions);
+}
+
 std::vector<LabeledNode<GroundTag>> SuccessorGenerator<GroundTag>::get_labeled_successor_nodes(const Node<GroundTag>& node)
 {
     auto result = std::vector<LabeledNode<GroundTag>> {};
@@ -74,11 +86,10 @@ void SuccessorGenerator<GroundTag>::get_labeled_successor_nodes(const Node<Groun
 {
     out_nodes.clear();
 
-    const auto state = node.get_state();
-
-    const auto state_context = StateContext<GroundTag>(*m_task, state.get_unpacked_state(), node.get_metric());
+    const auto state = StateHandle<GroundTag>(*m_task, node.get_state().get_unpacked_state());
+    const auto state_context = state.get_context(node.get_metric());
 
-    m_task->get_action_match_tree()->generate(state_context, m_applicable_actions);
+    generate_applicable_actions(state_context);
 
     for (const auto ground_action : make_view(m_applicable_actions, *m_task->get_repository()))
     {
@@ -87,10 +98,26 @@ void SuccessorGenerator<GroundTag>::get_labeled_successor_nodes(const Node<Groun
     }
 }
 
+void SuccessorGenerator<GroundTag>::get_applicable_actions(const Node<GroundTag>& node, std::vector<fp::GroundActionView>& out_actions)
+{
+    out_actions.clear();
+
+    const auto state = StateHandle<GroundTag>(*m_task, node.get_state().get_unpacked_state());
+    const auto state_context = state.get_context(node.get_metric());
+
+    generate_applicable_actions(state_context);
+
+    for (const auto ground_action : make_view(m_applicable_actions, *m_task->get_repository()))
+    {
+        if (m_executor.is_applicable(ground_action, state_context))
+            out_actions.push_back(ground_action);
+    }
+}
+
 Node<GroundTag> SuccessorGenerator<GroundTag>::get_successor_node(const Node<GroundTag>& node, fp::GroundActionView action)
 {
-    const auto& state = node.get_state();
-    const auto state_context = StateContext<GroundTag>(*m_task, state.get_unpacked_state(), node.get_metric());
+    const auto state = StateHandle<GroundTag>(*m_task, node.get_state().get_unpacked_state());
+    const auto state_context = state.get_context(node.get_metric());
 
     return m_executor.apply_action(state_context, action, *m_state_repository);
 }
@@ -25,6 +25,10 @@
 #include "tyr/planning/heuristics/projection_abstraction.hpp"
 #include "tyr/planning/lifted_task.hpp"
 
+#include <boost/dynamic_bitset.hpp>
+#include <algorithm>
+#include <utility>
+
 namespace f = tyr::formalism;
 namespace fp = tyr::formalism::planning;
 namespace u = tyr::formalism::unification;
@@ -33,49 +37,102 @@ namespace tyr::planning
 {
 namespace
 {
+std::vector<std::pair<uint_t, uint_t>> get_sorted_facts(const Pattern& pattern, const std::vector<uint_t>& positions)
+{
+    auto result = std::vector<std::pair<uint_t, uint_t>> {};
+    for (const auto i : positions)
+        result.emplace_back(uint_t(pattern.facts[i].get_data().variable), uint_t(pattern.facts[i].get_data().value));
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+/// @brief Compute a key that identifies the mapping of a projection up to the order of its facts and groups.
+///
+/// The groups are part of the key, since projections onto the same facts with different mutex groups have different abstract states.
 template<TaskKind Kind>
-auto create_component_heuristics(const ProjectionAbstractionList<Kind>& projections)
+std::vector<uint_t> get_mapping_key(const ProjectionMapping<Kind>& mapping)
 {
-    auto result = std::vector<std::shared_ptr<Heuristic<Kind>>> {};
-    for (const auto& projection : projections)
-        result.push_back(ProjectionAbstractionHeuristic<Kind>::create(projection));
+    const auto& pattern = mapping.get_pattern();
 
+    auto groups = std::vector<std::vector<std::pair<uint_t, uint_t>>> {};
+    for (const auto& group : mapping.get_groups())
+        groups.push_back(get_sorted_facts(pattern, group.positions));
+    std::sort(groups.begin(), groups.end());
+
+    // Each group is prefixed by its size, such that the facts of a pattern determine the partition into groups.
+    auto result = std::vector<uint_t> {};
+    for (const auto& group : groups)
+    {
+        result.push_back(uint_t(group.size()));
+        for (const auto& [variable, value] : group)
+        {
+            result.push_back(variable);
+            result.push_back(value);
+        }
+    }
     return result;
 }
 
-using Binding = u::SubstitutionFunction<Index<f::Object>>;
-using LabelsByAction = UnorderedMap<fp::ActionView, std::vector<Binding>>;
+bool is_subset(const Pattern& lhs, const Pattern& rhs)
+{
+    return std::all_of(lhs.facts.begin(), lhs.facts.end(), [&](const auto fact) { return rhs.facts_set.contains(fact); });
+}
 
-template<typename T>
-bool substitutions_equal_exact(const u::SubstitutionFunction<T>& lhs, const u::SubstitutionFunction<T>& rhs)
+/// @brief Remove each clique whose patterns are all subsets of patterns of another clique.
+///
+/// The projection onto a superset of a pattern refines the projection onto the pattern, such that the dominating clique
+/// has at least the same estimate in every state. Of two cliques that dominate each other, the first is kept.
+template<TaskKind Kind>
+std::vector<std::vector<uint_t>> prune_dominated_cliques(std::vector<std::vector<uint_t>> cliques,
+                                                         const std::vector<std::shared_ptr<ProjectionAbstractionHeuristic<Kind>>>& components)
 {
-    if (lhs.parameters() != rhs.parameters())
-        return false;
+    const auto k = components.size();
 
-    for (const auto p : lhs.parameters())
+    auto subset = std::vector<boost::dynamic_bitset<>>(k, boost::dynamic_bitset<>(k));
+    for (uint_t i = 0; i < k; ++i)
+        for (uint_t j = 0; j < k; ++j)
+            if (is_subset(components[i]->get_mapping().get_pattern(), components[j]->get_mapping().get_pattern()))
+                subset[i].set(j);
+
+    const auto is_dominated_by = [&](const auto& lhs, const auto& rhs)
+    { return std::all_of(lhs.begin(), lhs.end(), [&](const auto i) { return std::any_of(rhs.begin(), rhs.end(), [&](const auto j) { return subset[i].test(j); }); }); };
+
+    auto pruned = boost::dynamic_bitset<>(cliques.size());
+    for (uint_t a = 0; a < cliques.size(); ++a)
     {
-        if (lhs[p] != rhs[p])
-            return false;
+        for (uint_t b = 0; b < cliques.size(); ++b)
+        {
+            if (a == b || pruned.test(b) || !is_dominated_by(cliques[a], cliques[b]))
+                continue;
+
+            if (b < a || !is_dominated_by(cliques[b], cliques[a]))
+            {
+                pruned.set(a);
+                break;
+            }
+        }
     }
 
-    return true;
+    auto result = std::vector<std::vector<uint_t>> {};
+    for (uint_t a = 0; a < cliques.size(); ++a)
+        if (!pruned.test(a))
+            result.push_back(std::move(cliques[a]));
+
+    return result;
 }
 
+using Binding = u::SubstitutionFunction<Index<f::Object>>;
+using LabelsByAction = UnorderedMap<fp::ActionView, std::vector<Binding>>;
+
 template<typename T>
-bool substitutions_compatible(const u::SubstitutionFunction<T>& lhs, const u::SubstitutionFunction<T>& rhs)
+bool substitutions_equal_exact(const u::SubstitutionFunction<T>& lhs, const u::SubstitutionFunction<T>& rhs)
 {
+    if (lhs.parameters() != rhs.parameters())
+        return false;
+
     for (const auto p : lhs.parameters())
     {
-        const auto* lhs_slot = lhs.try_get(p);
-        const auto* rhs_slot = rhs.try_get(p);
-
-        if (lhs_slot == nullptr || rhs_slot == nullptr)
-            continue;
-
-        if (!lhs_slot->has_value() || !rhs_slot->has_value())
-            continue;
-
-        if (**lhs_slot != **rhs_slot)
+        if (lhs[p] != rhs[p])
             return false;
     }
 
@@ -91,6 +148,18 @@ void push_unique_exact(std::vector<u::SubstitutionFunction<T>>& vec, const u::Su
     }
 }
 
+template<TaskKind Kind>
+LabelsByAction collect_labels(const ProjectionAbstraction<Kind>& projection)
+{
+    auto result = LabelsByAction {};
+
+    // The labels are those of the state-changing transitions, since the projections contain no self-loops.
+    for (const auto& label : projection.labels())
+        push_unique_exact(result[label.original_action], label.substitution);
+
+    return result;
+}
+
 template<TaskKind Kind>
 auto collect_labels(const ProjectionAbstractionList<Kind>& projections)
 {
@@ -98,18 +167,7 @@ auto collect_labels(const ProjectionAbstractionList<Kind>& projections)
     result.reserve(projections.size());
 
     for (const auto& projection : projections)
-    {
-        auto labels = LabelsByAction {};
-
-        const auto& changing = projection.state_changing_transitions();
-        for (auto t = changing.find_first(); t != boost::dynamic_bitset<>::npos; t = changing.find_next(t))
-        {
-            const auto& transition = projection.transitions()[t];
-            push_unique_exact(labels[transition.original_action], transition.substitution);
-        }
-
-        result.push_back(std::move(labels));
-    }
+        result.push_back(collect_labels(projection));
 
     return result;
 }
@@ -128,7 +186,7 @@ bool labels_overlap(const LabelsByAction& lhs, const LabelsByAction& rhs)
         {
             for (const auto& sigma_r : rhs_bindings)
             {
-                if (substitutions_compatible(sigma_l, sigma_r))
+                if (are_compatible(sigma_l, sigma_r))
                     return true;
             }
         }
@@ -165,11 +223,64 @@ auto create_additivity_graph(const ProjectionAbstractionList<Kind>& projections)
 
 }
 
+template<TaskKind Kind>
+bool are_additive(const ProjectionAbstraction<Kind>& lhs, const ProjectionAbstraction<Kind>& rhs)
+{
+    return !labels_overlap(collect_labels(lhs), collect_labels(rhs));
+}
+
+template bool are_additive(const ProjectionAbstraction<LiftedTag>& lhs, const ProjectionAbstraction<LiftedTag>& rhs);
+template bool are_additive(const ProjectionAbstraction<GroundTag>& lhs, const ProjectionAbstraction<GroundTag>& rhs);
+
+template<TaskKind Kind>
+std::vector<std::vector<uint_t>> compute_maximal_additive_subsets(const ProjectionAbstractionList<Kind>& projections)
+{
+    return graphs::bron_kerbosch::compute_maximal_cliques(create_additivity_graph(projections));
+}
+
+template std::vector<std::vector<uint_t>> compute_maximal_additive_subsets(const ProjectionAbstractionList<LiftedTag>& projections);
+template std::vector<std::vector<uint_t>> compute_maximal_additive_subsets(const ProjectionAbstractionList<GroundTag>& projections);
+
 template<TaskKind Kind>
 CanonicalHeuristic<Kind>::CanonicalHeuristic(const ProjectionAbstractionList<Kind>& projections) :
-    m_components(create_component_heuristics(projections)),
-    m_additive_partitions(graphs::bron_kerbosch::compute_maximal_cliques(create_additivity_graph(projections)))
+    m_components(),
+    m_clique_offsets(),
+    m_clique_components(),
+    m_tables(),
+    m_abstract_states(),
+    m_values()
 {
+    // Projections onto the same pattern and groups have the same estimates, such that they share a component.
+    auto component_of_projection = std::vector<uint_t> {};
+    auto component_of_pattern = UnorderedMap<std::vector<uint_t>, uint_t> {};
+    for (const auto& projection : projections)
+    {
+        const auto [it, inserted] = component_of_pattern.emplace(get_mapping_key(projection.get_mapping()), uint_t(m_components.size()));
+        if (inserted)
+            m_components.push_back(ProjectionAbstractionHeuristic<Kind>::create(projection));
+        component_of_projection.push_back(it->second);
+    }
+
+    auto cliques = compute_maximal_additive_subsets(projections);
+    for (auto& clique : cliques)
+    {
+        for (auto& i : clique)
+            i = component_of_projection[i];
+        std::sort(clique.begin(), clique.end());
+        clique.erase(std::unique(clique.begin(), clique.end()), clique.end());
+    }
+
+    m_clique_offsets.push_back(0);
+    for (const auto& clique : prune_dominated_cliques(std::move(cliques), m_components))
+    {
+        m_clique_components.insert(m_clique_components.end(), clique.begin(), clique.end());
+        m_clique_offsets.push_back(uint_t(m_clique_components.size()));
+    }
+
+    for (const auto& component : m_components)
+        m_tables.push_back(&component->get_distances());
+    m_abstract_states.resize(m_components.size());
+    m_values.resize(m_components.size());
 }
 
 template<TaskKind Kind>
@@ -181,15 +292,18 @@ std::shared_ptr<CanonicalHeuristic<Kind>> CanonicalHeuristic<Kind>::create(const
 template<TaskKind Kind>
 float_t CanonicalHeuristic<Kind>::evaluate(const StateView<Kind>& state)
 {
+    // First compute all abstract states, then look up all distances, such that the table lookups do not wait on each other.
+    for (uint_t i = 0; i < m_components.size(); ++i)
+        m_abstract_states[i] = m_components[i]->get_mapping().map_state(state);
+
+    gather(m_tables, m_abstract_states, m_values);
+
     float_t h = 0;
-    for (const auto& partition : m_additive_partitions)
+    for (size_t c = 0; c + 1 < m_clique_offsets.size(); ++c)
     {
         float_t h_sum = 0;
-        for (const auto& i : partition)
-        {
-            const auto h_i = m_components[i];
-            h_sum += h_i->evaluate(state);
-        }
+        for (auto i = m_clique_offsets[c]; i < m_clique_offsets[c + 1]; ++i)
+            h_sum += m_values[m_clique_components[i]];
 
         h = std::max(h, h_sum);
     }
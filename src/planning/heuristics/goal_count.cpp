@@ -21,12 +21,20 @@
 #include "tyr/planning/ground_task.hpp"
 #include "tyr/planning/lifted_task.hpp"
 
+#include <algorithm>
+
 namespace tyr::planning
 {
 
 template<TaskKind Kind>
-GoalCountHeuristic<Kind>::GoalCountHeuristic(std::shared_ptr<const Task<Kind>> task) : m_task(std::move(task)), m_goal(m_task->get_task().get_goal())
+GoalCountHeuristic<Kind>::GoalCountHeuristic(std::shared_ptr<const Task<Kind>> task) :
+    m_task(std::move(task)),
+    m_goal(m_task->get_task().get_goal()),
+    m_incremental(false),
+    m_goal_facts_by_variable(),
+    m_touched_variables()
 {
+    index_goal_facts();
 }
 
 template<TaskKind Kind>
@@ -39,6 +47,22 @@ template<TaskKind Kind>
 void GoalCountHeuristic<Kind>::set_goal(formalism::planning::GroundConjunctiveConditionView goal)
 {
     m_goal = goal;
+
+    index_goal_facts();
+}
+
+template<TaskKind Kind>
+void GoalCountHeuristic<Kind>::index_goal_facts()
+{
+    m_incremental = m_goal.template get_literals<formalism::DerivedTag>().empty() && m_goal.get_numeric_constraints().empty();
+
+    m_goal_facts_by_variable.clear();
+
+    for (const auto fact : m_goal.template get_facts<formalism::PositiveTag>())
+        m_goal_facts_by_variable[fact.get_data().variable].emplace_back(fact, true);
+
+    for (const auto fact : m_goal.template get_facts<formalism::NegativeTag>())
+        m_goal_facts_by_variable[fact.get_data().variable].emplace_back(fact, false);
 }
 
 template<TaskKind Kind>
@@ -75,6 +99,50 @@ float_t GoalCountHeuristic<Kind>::evaluate(const StateView<Kind>& state)
     return unsat_counter;
 }
 
+template<TaskKind Kind>
+float_t GoalCountHeuristic<Kind>::evaluate_successor(const StateView<Kind>& state,
+                                                     float_t value,
+                                                     formalism::planning::GroundActionView action,
+                                                     const StateView<Kind>& succ_state)
+{
+    if (!m_incremental)
+        return evaluate(succ_state);
+
+    // Only goal facts on variables that occur in an effect of the action can change their satisfaction.
+    m_touched_variables.clear();
+    for (const auto cond_effect : action.get_effects())
+    {
+        const auto effect = cond_effect.get_effect();
+
+        for (const auto fact : effect.template get_facts<formalism::PositiveTag>())
+            m_touched_variables.push_back(fact.get_data().variable);
+        for (const auto fact : effect.template get_facts<formalism::NegativeTag>())
+            m_touched_variables.push_back(fact.get_data().variable);
+    }
+    std::sort(m_touched_variables.begin(), m_touched_variables.end());
+    m_touched_variables.erase(std::unique(m_touched_variables.begin(), m_touched_variables.end()), m_touched_variables.end());
+
+    const auto state_context = StateContext<Kind> { *m_task, state.get_unpacked_state(), float_t { 0 } };
+    const auto succ_state_context = StateContext<Kind> { *m_task, succ_state.get_unpacked_state(), float_t { 0 } };
+
+    const auto is_satisfied = [](auto fact, bool polarity, const StateContext<Kind>& context)
+    { return polarity ? is_applicable<formalism::PositiveTag>(fact, context) : is_applicable<formalism::NegativeTag>(fact, context); };
+
+    auto unsat_counter = value;
+
+    for (const auto variable : m_touched_variables)
+    {
+        const auto it = m_goal_facts_by_variable.find(variable);
+        if (it == m_goal_facts_by_variable.end())
+            continue;
+
+        for (const auto& [fact, polarity] : it->second)
+            unsat_counter += float_t(is_satisfied(fact, polarity, state_context)) - float_t(is_satisfied(fact, polarity, succ_state_context));
+    }
+
+    return unsat_counter;
+}
+
 template class GoalCountHeuristic<LiftedTag>;
 template class GoalCountHeuristic<GroundTag>;
 
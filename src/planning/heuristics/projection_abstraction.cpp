@@ -17,7 +17,6 @@
 
 #include "tyr/planning/heuristics/projection_abstraction.hpp"
 
-#include "tyr/graphs/bgl_algorithms.hpp"
 #include "tyr/planning/ground_task.hpp"
 #include "tyr/planning/lifted_task.hpp"
 
@@ -26,17 +25,12 @@ namespace tyr::planning
 
 template<TaskKind Kind>
 ProjectionAbstractionHeuristic<Kind>::ProjectionAbstractionHeuristic(const ProjectionAbstraction<Kind>& projection) :
-    m_distances(),
-    m_mapping(projection.get_mapping())
+    m_distances(projection.get_distances()),
+    m_mapping(projection.get_mapping()),
+    m_cached_state_repository(nullptr),
+    m_cached_state(Index<State<Kind>>::max()),
+    m_cached_abstract_state(0)
 {
-    auto weights = std::vector<float_t>(projection.get_forward().num_edges(), float_t { 1 });
-
-    const auto [predecessors, distances] = graphs::dijkstra_shortest_paths(projection.get_backward(),
-                                                                           weights,
-                                                                           projection.get_backward().goal_vertices().begin(),
-                                                                           projection.get_backward().goal_vertices().end());
-
-    m_distances = std::move(distances);
 }
 
 template<TaskKind Kind>
@@ -48,7 +42,23 @@ std::shared_ptr<ProjectionAbstractionHeuristic<Kind>> ProjectionAbstractionHeuri
 template<TaskKind Kind>
 float_t ProjectionAbstractionHeuristic<Kind>::evaluate(const StateView<Kind>& state)
 {
-    return m_distances.at(m_mapping.map_state(state));
+    return (*m_distances)[m_mapping.map_state(state)];
+}
+
+template<TaskKind Kind>
+float_t ProjectionAbstractionHeuristic<Kind>::evaluate_successor(const StateView<Kind>& state,
+                                                                 float_t value,
+                                                                 formalism::planning::GroundActionView action,
+                                                                 const StateView<Kind>& succ_state)
+{
+    if (state.get_state_repository().get() != m_cached_state_repository || state.get_index() != m_cached_state)
+    {
+        m_cached_state_repository = state.get_state_repository().get();
+        m_cached_state = state.get_index();
+        m_cached_abstract_state = m_mapping.map_state(state);
+    }
+
+    return (*m_distances)[m_mapping.map_successor_state(m_cached_abstract_state, action, succ_state)];
 }
 
 template class ProjectionAbstractionHeuristic<LiftedTag>;
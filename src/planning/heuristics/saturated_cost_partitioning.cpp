@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/heuristics/saturated_cost_partitioning.hpp"
+
+#include "tyr/common/equal_to.hpp"
+#include "tyr/common/hash.hpp"
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/lifted_task.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::planning
+{
+namespace
+{
+
+struct TransitionLabels
+{
+    uint_t num_labels = 0;
+    std::vector<std::vector<uint_t>> label_of_transition;  ///< indexed by projection and transition
+    std::vector<float_t> costs;                            ///< indexed by label
+};
+
+/// @brief Compute a key that identifies a label by its original action and the objects of its substitution, where unbound parameters are none.
+std::vector<uint_t> get_label_key(const TransitionLabel& label)
+{
+    auto result = std::vector<uint_t> { uint_t(label.original_action.get_index()) };
+    for (const auto p : label.substitution.parameters())
+    {
+        const auto& object = label.substitution[p];
+        result.push_back(object.has_value() ? uint_t(*object) : std::numeric_limits<uint_t>::max());
+    }
+    return result;
+}
+
+/// @brief Partition the labels of all projections into classes, assign each transition the dense index of the class of its label,
+/// and each class the smallest cost of its labels.
+///
+/// Two labels are in the same class if they can represent a common ground action, see are_compatible. Since compatibility is not transitive,
+/// the classes are the connected components of the compatibility graph. All labels that represent a given ground action are pairwise compatible
+/// and thus in the same class, such that the costs of the classes are partitioned without exceeding the cost of any ground action.
+template<TaskKind Kind>
+TransitionLabels compute_transition_labels(const ProjectionAbstractionList<Kind>& projections)
+{
+    // The distinct labels over all projections.
+    auto distinct_labels = std::vector<const TransitionLabel*> {};
+    auto distinct_costs = std::vector<float_t> {};
+    auto distinct_of_label = std::vector<std::vector<uint_t>>(projections.size());
+    auto distinct_of_key = UnorderedMap<std::vector<uint_t>, uint_t> {};
+    auto distinct_by_action = UnorderedMap<fp::ActionView, std::vector<uint_t>> {};
+
+    for (uint_t i = 0; i < projections.size(); ++i)
+    {
+        const auto& projection = projections[i];
+        const auto& labels = projection.labels();
+
+        for (uint_t l = 0; l < labels.size(); ++l)
+        {
+            const auto [it, inserted] = distinct_of_key.emplace(get_label_key(labels[l]), uint_t(distinct_labels.size()));
+            if (inserted)
+            {
+                distinct_labels.push_back(&labels[l]);
+                distinct_costs.push_back(projection.get_label_costs()[l]);
+                distinct_by_action[labels[l].original_action].push_back(it->second);
+            }
+            distinct_costs[it->second] = std::min(distinct_costs[it->second], projection.get_label_costs()[l]);
+            distinct_of_label[i].push_back(it->second);
+        }
+    }
+
+    // Merge the compatible labels of each action by union-find.
+    auto parent = std::vector<uint_t>(distinct_labels.size());
+    std::iota(parent.begin(), parent.end(), uint_t(0));
+
+    const auto find_root = [&](uint_t x)
+    {
+        while (parent[x] != x)
+            x = parent[x] = parent[parent[x]];
+        return x;
+    };
+
+    for (const auto& [action, members] : distinct_by_action)
+    {
+        for (uint_t a = 0; a < members.size(); ++a)
+        {
+            for (uint_t b = a + 1; b < members.size(); ++b)
+            {
+                const auto root_a = find_root(members[a]);
+                const auto root_b = find_root(members[b]);
+                if (root_a != root_b && are_compatible(*distinct_labels[members[a]], *distinct_labels[members[b]]))
+                    parent[root_b] = root_a;
+            }
+        }
+    }
+
+    auto result = TransitionLabels {};
+
+    auto class_of_distinct = std::vector<uint_t>(distinct_labels.size());
+    auto class_of_root = UnorderedMap<uint_t, uint_t> {};
+    for (uint_t d = 0; d < distinct_labels.size(); ++d)
+    {
+        const auto [it, inserted] = class_of_root.emplace(find_root(d), uint_t(result.costs.size()));
+        if (inserted)
+            result.costs.push_back(std::numeric_limits<float_t>::infinity());
+        result.costs[it->second] = std::min(result.costs[it->second], distinct_costs[d]);
+        class_of_distinct[d] = it->second;
+    }
+    result.num_labels = result.costs.size();
+
+    for (uint_t i = 0; i < projections.size(); ++i)
+    {
+        const auto& forward = projections[i].get_forward();
+
+        auto& labels = result.label_of_transition.emplace_back();
+        labels.reserve(forward.num_edges());
+        for (uint_t t = 0; t < forward.num_edges(); ++t)
+            labels.push_back(class_of_distinct[distinct_of_label[i][forward.get_label_index(t)]]);
+    }
+
+    return result;
+}
+
+/// @brief Compute the goal distances of the projections under the saturated cost partitioning for the given order.
+template<TaskKind Kind>
+std::vector<std::vector<float_t>>
+compute_saturated_cost_partitioning(const ProjectionAbstractionList<Kind>& projections, const TransitionLabels& labels, const std::vector<uint_t>& order)
+{
+    auto result = std::vector<std::vector<float_t>>(projections.size());
+    auto remaining_costs = labels.costs;
+    auto saturated_costs = std::vector<float_t>(labels.num_labels);
+    auto weights = std::vector<float_t> {};
+
+    for (const auto i : order)
+    {
+        const auto& projection = projections[i];
+        const auto& forward = projection.get_forward();
+        const auto& label_of_transition = labels.label_of_transition[i];
+
+        weights.resize(forward.num_edges());
+        for (uint_t t = 0; t < forward.num_edges(); ++t)
+            weights[t] = remaining_costs[label_of_transition[t]];
+
+        auto distances = compute_goal_distances(projection.get_backward(), weights);
+
+        // The saturated cost of a label is the largest decrease of the goal distance over its transitions between states that can reach the goal.
+        // Negative saturated costs are not passed on, such that the remaining costs stay nonnegative for Dijkstra.
+        std::fill(saturated_costs.begin(), saturated_costs.end(), float_t { 0 });
+        for (uint_t v = 0; v < forward.num_vertices(); ++v)
+        {
+            const auto src_distance = distances[v];
+            if (!std::isfinite(src_distance))
+                continue;
+
+            for (const auto t : forward.get_transitions(v))
+            {
+                const auto dst_distance = distances[forward.get_target(t)];
+                if (std::isfinite(dst_distance))
+                {
+                    auto& saturated_cost = saturated_costs[label_of_transition[t]];
+                    saturated_cost = std::max(saturated_cost, src_distance - dst_distance);
+                }
+            }
+        }
+
+        for (uint_t l = 0; l < labels.num_labels; ++l)
+            remaining_costs[l] = std::max(float_t { 0 }, remaining_costs[l] - saturated_costs[l]);
+
+        result[i] = std::move(distances);
+    }
+
+    return result;
+}
+
+}
+
+template<TaskKind Kind>
+SaturatedCostPartitioningHeuristic<Kind>::SaturatedCostPartitioningHeuristic(const ProjectionAbstractionList<Kind>& projections,
+                                                                             const std::vector<StateView<Kind>>& samples,
+                                                                             SaturatedCostPartitioningOptions options) :
+    m_mappings(),
+    m_tables(),
+    m_table_ptrs(),
+    m_abstract_states(),
+    m_values()
+{
+    const auto k = projections.size();
+
+    for (const auto& projection : projections)
+        m_mappings.push_back(projection.get_mapping());
+
+    const auto labels = compute_transition_labels(projections);
+
+    auto sample_abstract_states = std::vector<std::vector<uint_t>> {};
+    for (const auto& sample : samples)
+    {
+        auto& abstract_states = sample_abstract_states.emplace_back();
+        for (const auto& mapping : m_mappings)
+            abstract_states.push_back(mapping.map_state(sample));
+    }
+    auto sample_values = std::vector<float_t>(samples.size(), float_t { 0 });
+
+    auto rng = std::mt19937(options.random_seed);
+    auto order = std::vector<uint_t>(k);
+    std::iota(order.begin(), order.end(), uint_t(0));
+    auto seen_orders = UnorderedSet<std::vector<uint_t>> {};
+
+    for (uint_t o = 0; o < options.max_orders && k > 0; ++o)
+    {
+        if (o > 0)
+            std::shuffle(order.begin(), order.end(), rng);
+
+        if (!seen_orders.insert(order).second)
+            continue;
+
+        const auto distances = compute_saturated_cost_partitioning(projections, labels, order);
+
+        // An order is diverse if it improves the best estimate of some sample. The first order is always kept.
+        auto is_diverse = (o == 0 || samples.empty());
+        for (uint_t s = 0; s < samples.size(); ++s)
+        {
+            auto h = float_t { 0 };
+            for (uint_t i = 0; i < k; ++i)
+                h += (sample_abstract_states[s][i] < distances[i].size()) ? distances[i][sample_abstract_states[s][i]] : std::numeric_limits<float_t>::infinity();
+
+            if (h > sample_values[s] + std::numeric_limits<float_t>::epsilon() * std::max(float_t { 1 }, h))
+            {
+                sample_values[s] = h;
+                is_diverse = true;
+            }
+        }
+
+        if (!is_diverse)
+            continue;
+
+        for (uint_t i = 0; i < k; ++i)
+            m_tables.emplace_back(distances[i]);
+    }
+
+    for (const auto& table : m_tables)
+        m_table_ptrs.push_back(&table);
+    m_abstract_states.resize(m_tables.size());
+    m_values.resize(m_tables.size());
+}
+
+template<TaskKind Kind>
+std::shared_ptr<SaturatedCostPartitioningHeuristic<Kind>> SaturatedCostPartitioningHeuristic<Kind>::create(const ProjectionAbstractionList<Kind>& projections,
+                                                                                                          const std::vector<StateView<Kind>>& samples,
+                                                                                                          SaturatedCostPartitioningOptions options)
+{
+    return std::make_shared<SaturatedCostPartitioningHeuristic<Kind>>(projections, samples, options);
+}
+
+template<TaskKind Kind>
+float_t SaturatedCostPartitioningHeuristic<Kind>::evaluate(const StateView<Kind>& state)
+{
+    const auto k = m_mappings.size();
+    if (k == 0)
+        return float_t { 0 };
+
+    // The abstract states do not depend on the order, such that they are computed once and repeated for each order.
+    for (uint_t i = 0; i < k; ++i)
+        m_abstract_states[i] = m_mappings[i].map_state(state);
+    for (size_t j = k; j < m_abstract_states.size(); ++j)
+        m_abstract_states[j] = m_abstract_states[j - k];
+
+    gather(m_table_ptrs, m_abstract_states, m_values);
+
+    float_t h = 0;
+    for (size_t begin = 0; begin < m_values.size(); begin += k)
+    {
+        float_t h_sum = 0;
+        for (size_t i = begin; i < begin + k; ++i)
+            h_sum += m_values[i];
+
+        h = std::max(h, h_sum);
+    }
+    return h;
+}
+
+template class SaturatedCostPartitioningHeuristic<LiftedTag>;
+template class SaturatedCostPartitioningHeuristic<GroundTag>;
+
+}
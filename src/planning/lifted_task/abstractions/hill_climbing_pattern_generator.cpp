@@ -0,0 +1,356 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/lifted_task/abstractions/hill_climbing_pattern_generator.hpp"
+
+#include "tyr/common/chrono.hpp"
+#include "tyr/common/equal_to.hpp"
+#include "tyr/common/hash.hpp"
+#include "tyr/common/onetbb.hpp"
+#include "tyr/formalism/planning/fdr_context.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/formalism/planning/views.hpp"
+#include "tyr/planning/abstractions/explicit_projection.hpp"
+#include "tyr/planning/abstractions/goal_pattern_generator.hpp"
+#include "tyr/planning/heuristics/canonical.hpp"
+#include "tyr/planning/node.hpp"
+#include "tyr/planning/lifted_task/state_view.hpp"
+#include "tyr/planning/lifted_task/successor_generator.hpp"
+
+#include <boost/dynamic_bitset.hpp>
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::planning
+{
+namespace
+{
+
+using PredicateSet = UnorderedSet<fp::PredicateView<f::FluentTag>>;
+using CausalGraphPredecessors = UnorderedMap<fp::PredicateView<f::FluentTag>, PredicateSet>;
+
+/// @brief Compute the predecessors of each fluent predicate in the predicate-level causal graph,
+/// i.e., the fluent predicates in the conditions and effects of the action schemas that change it.
+CausalGraphPredecessors compute_causal_graph_predecessors(const Task<LiftedTag>& task)
+{
+    auto result = CausalGraphPredecessors {};
+
+    for (const auto action : task.get_domain().get_domain().get_actions())
+    {
+        auto action_predicates = PredicateSet {};
+        for (const auto literal : action.get_condition().get_literals<f::FluentTag>())
+            action_predicates.insert(literal.get_atom().get_predicate());
+
+        for (const auto cond_effect : action.get_effects())
+        {
+            auto sources = action_predicates;
+            for (const auto literal : cond_effect.get_condition().get_literals<f::FluentTag>())
+                sources.insert(literal.get_atom().get_predicate());
+
+            auto targets = PredicateSet {};
+            for (const auto literal : cond_effect.get_effect().get_literals())
+                targets.insert(literal.get_atom().get_predicate());
+
+            sources.insert(targets.begin(), targets.end());
+
+            for (const auto target : targets)
+                for (const auto source : sources)
+                    if (!EqualTo<fp::PredicateView<f::FluentTag>> {}(source, target))
+                        result[target].insert(source);
+        }
+    }
+
+    return result;
+}
+
+/// @brief Append the facts of the atoms of the initial state and the goal that are not yet seen.
+void collect_candidate_facts(Task<LiftedTag>& task, UnorderedSet<fp::FDRFactView<f::FluentTag>>& seen, fp::FDRFactViewList<f::FluentTag>& out_facts)
+{
+    for (const auto atom : task.get_task().get_atoms<f::FluentTag>())
+    {
+        const auto fact = task.get_fdr_context()->get_fact_view(atom);
+        if (seen.insert(fact).second)
+            out_facts.push_back(fact);
+    }
+
+    for (const auto fact : task.get_task().get_goal().get_facts<f::PositiveTag>())
+        if (seen.insert(fact).second)
+            out_facts.push_back(fact);
+}
+
+/// @brief Append the facts of the atoms of the sampled states that are not yet seen, i.e., reachable atoms that can hold in the middle of a plan.
+void collect_candidate_facts(const std::vector<StateView<LiftedTag>>& samples,
+                             UnorderedSet<fp::FDRFactView<f::FluentTag>>& seen,
+                             fp::FDRFactViewList<f::FluentTag>& out_facts)
+{
+    for (const auto& sample : samples)
+        for (const auto fact : sample.get_fluent_facts_view())
+            if (seen.insert(fact).second)
+                out_facts.push_back(fact);
+}
+
+bool is_causally_relevant(fp::GroundAtomView<f::FluentTag> atom, const Pattern& pattern, const CausalGraphPredecessors& predecessors)
+{
+    return std::any_of(pattern.predicates_set.begin(),
+                       pattern.predicates_set.end(),
+                       [&](const auto predicate)
+                       {
+                           const auto it = predecessors.find(predicate);
+                           return it != predecessors.end() && it->second.contains(atom.get_predicate());
+                       });
+}
+
+bool shares_object(fp::GroundAtomView<f::FluentTag> atom, const Pattern& pattern)
+{
+    const auto objects = atom.get_row().get_objects();
+    if (objects.empty())
+        return true;
+
+    for (const auto pattern_atom : pattern.atoms_set)
+        for (const auto lhs : objects)
+            for (const auto rhs : pattern_atom.get_row().get_objects())
+                if (lhs.get_index() == rhs.get_index())
+                    return true;
+
+    return false;
+}
+
+std::vector<uint_t> get_key(const Pattern& pattern)
+{
+    auto result = std::vector<uint_t> {};
+    for (const auto atom : pattern.atoms_set)
+        result.push_back(uint_t(atom.get_index()));
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+/// @brief Sample states by random walks from the initial state.
+///
+/// As in iPDB, the walk lengths are uniform in [0, 4 h(s_0)], such that their mean is twice the estimated goal distance of the initial state.
+std::vector<StateView<LiftedTag>> sample_states(SuccessorGenerator<LiftedTag>& successor_generator, Heuristic<LiftedTag>& heuristic, uint_t num_samples, std::mt19937& rng)
+{
+    const auto initial_node = successor_generator.get_initial_node();
+    const auto h_init = heuristic.evaluate(initial_node.get_state());
+    const auto max_length = std::isfinite(h_init) ? uint_t(std::max(float_t { 1 }, 4 * h_init)) : uint_t(10);
+
+    auto samples = std::vector<StateView<LiftedTag>> {};
+    auto successors = std::vector<LabeledNode<LiftedTag>> {};
+    samples.reserve(num_samples);
+
+    for (uint_t i = 0; i < num_samples; ++i)
+    {
+        auto node = initial_node;
+        const auto length = std::uniform_int_distribution<uint_t>(0, max_length)(rng);
+
+        for (uint_t step = 0; step < length; ++step)
+        {
+            successors.clear();
+            successor_generator.get_labeled_successor_nodes(node, successors);
+            if (successors.empty())
+                break;
+
+            node = successors[std::uniform_int_distribution<size_t>(0, successors.size() - 1)(rng)].node;
+        }
+
+        samples.push_back(node.get_state());
+    }
+
+    return samples;
+}
+
+/// @brief Compute the estimate of the projection for each sample.
+std::vector<float_t> evaluate_samples(const ProjectionAbstraction<LiftedTag>& projection, const std::vector<StateView<LiftedTag>>& samples)
+{
+    const auto& distances = *projection.get_distances();
+
+    auto result = std::vector<float_t> {};
+    result.reserve(samples.size());
+    for (const auto& sample : samples)
+        result.push_back(distances[projection.get_mapping().map_state(sample)]);
+
+    return result;
+}
+
+struct Candidate
+{
+    std::vector<uint_t> key;
+    std::optional<ProjectionAbstraction<LiftedTag>> projection;  ///< none if the pattern exceeds the size limits
+    boost::dynamic_bitset<> additive;                            ///< bit i is set iff the projection is additive with projection i of the collection
+};
+
+/// @brief Count the samples on which adding the candidate increases the canonical heuristic above the given values.
+///
+/// Every maximal additive subset of the extended collection that contains the candidate consists of the candidate and a subset
+/// of a maximal additive subset of the collection, such that h_new(s) = max(h(s), h_c(s) + max_C sum_{i in C, i additive with c} h_i(s)).
+uint_t count_improved_samples(const Candidate& candidate,
+                              const std::vector<std::vector<uint_t>>& cliques,
+                              const std::vector<std::vector<float_t>>& sample_values,
+                              const std::vector<StateView<LiftedTag>>& samples,
+                              const std::vector<float_t>& h_values)
+{
+    const auto candidate_values = evaluate_samples(*candidate.projection, samples);
+
+    auto result = uint_t(0);
+    for (uint_t s = 0; s < samples.size(); ++s)
+    {
+        if (!std::isfinite(h_values[s]))
+            continue;
+
+        auto h_max = float_t(0);
+        for (const auto& clique : cliques)
+        {
+            auto h_sum = float_t(0);
+            for (const auto i : clique)
+                if (candidate.additive.test(i))
+                    h_sum += sample_values[i][s];
+            h_max = std::max(h_max, h_sum);
+        }
+
+        if (candidate_values[s] + h_max > h_values[s])
+            ++result;
+    }
+
+    return result;
+}
+
+}
+
+HillClimbingPatternGenerator<LiftedTag>::HillClimbingPatternGenerator(std::shared_ptr<Task<LiftedTag>> task, HillClimbingPatternGeneratorOptions options) :
+    m_task(std::move(task)),
+    m_options(std::move(options))
+{
+}
+
+std::shared_ptr<HillClimbingPatternGenerator<LiftedTag>> HillClimbingPatternGenerator<LiftedTag>::create(std::shared_ptr<Task<LiftedTag>> task,
+                                                                                                         HillClimbingPatternGeneratorOptions options)
+{
+    return std::make_shared<HillClimbingPatternGenerator<LiftedTag>>(std::move(task), std::move(options));
+}
+
+PatternCollection HillClimbingPatternGenerator<LiftedTag>::generate()
+{
+    const auto watch = CountdownWatch(m_options.max_time);
+    auto rng = std::mt19937(m_options.random_seed);
+
+    auto patterns = GoalPatternGenerator<LiftedTag>(m_task).generate();
+    auto projections = ProjectionGenerator<LiftedTag>(m_task, patterns, m_options.projection_options).generate();
+
+    auto collection_size = uint64_t(0);
+    for (const auto& projection : projections)
+        collection_size += projection.get_forward().num_vertices();
+
+    const auto predecessors = compute_causal_graph_predecessors(*m_task);
+
+    auto seen_facts = UnorderedSet<fp::FDRFactView<f::FluentTag>> {};
+    auto candidate_facts = fp::FDRFactViewList<f::FluentTag> {};
+    collect_candidate_facts(*m_task, seen_facts, candidate_facts);
+
+    auto successor_generator = SuccessorGenerator<LiftedTag>(m_task, ExecutionContext::create(1));
+
+    // The projections of the candidates are kept across iterations, since adding a pattern only adds new candidates.
+    auto candidates = std::vector<Candidate> {};
+    auto seen_keys = UnorderedSet<std::vector<uint_t>> {};
+    for (const auto& pattern : patterns)
+        seen_keys.insert(get_key(pattern));
+
+    while (!watch.has_finished())
+    {
+        auto heuristic = CanonicalHeuristic<LiftedTag>(projections);
+        const auto samples = sample_states(successor_generator, heuristic, m_options.num_samples, rng);
+
+        auto h_values = std::vector<float_t> {};
+        for (const auto& sample : samples)
+            h_values.push_back(heuristic.evaluate(sample));
+
+        // The candidates are evaluated against the maximal additive subsets and the estimates of the collection, which are computed once per iteration.
+        const auto cliques = compute_maximal_additive_subsets(projections);
+        auto sample_values = std::vector<std::vector<float_t>> {};
+        for (const auto& projection : projections)
+            sample_values.push_back(evaluate_samples(projection, samples));
+
+        collect_candidate_facts(samples, seen_facts, candidate_facts);
+
+        /* Extend the patterns by the causally relevant candidate facts. */
+
+        for (uint_t p = 0; p < patterns.size() && !watch.has_finished(); ++p)
+        {
+            for (const auto fact : candidate_facts)
+            {
+                const auto atom = fact.get_atom().value();
+                if (patterns[p].atoms_set.contains(atom) || !is_causally_relevant(atom, patterns[p], predecessors) || !shares_object(atom, patterns[p]))
+                    continue;
+
+                auto facts = patterns[p].facts;
+                facts.push_back(fact);
+                auto pattern = Pattern(std::move(facts));
+
+                auto key = get_key(pattern);
+                if (!seen_keys.insert(key).second)
+                    continue;
+
+                auto candidate = Candidate { std::move(key), std::nullopt, boost::dynamic_bitset<>() };
+                if (pattern.atoms_set.size() <= 32
+                    && ProjectionMapping<LiftedTag>(pattern, m_options.projection_options.mutex_groups).num_abstract_states() <= m_options.max_pdb_size)
+                    candidate.projection = ProjectionGenerator<LiftedTag>(m_task, PatternCollection { pattern }, m_options.projection_options).generate().front();
+
+                candidates.push_back(std::move(candidate));
+            }
+        }
+
+        /* Select the candidate that improves the heuristic on the most samples. */
+
+        auto best_candidate = std::optional<size_t> {};
+        auto best_improvement = uint_t(0);
+
+        for (size_t c = 0; c < candidates.size() && !watch.has_finished(); ++c)
+        {
+            auto& candidate = candidates[c];
+            if (!candidate.projection || collection_size + candidate.projection->get_forward().num_vertices() > m_options.max_collection_size)
+                continue;
+
+            // Only the additivity with the projections added since the last evaluation of the candidate is computed.
+            for (auto i = candidate.additive.size(); i < projections.size(); ++i)
+                candidate.additive.push_back(are_additive(*candidate.projection, projections[i]));
+
+            const auto improvement = count_improved_samples(candidate, cliques, sample_values, samples, h_values);
+            if (improvement > best_improvement)
+            {
+                best_candidate = c;
+                best_improvement = improvement;
+            }
+        }
+
+        if (!best_candidate || best_improvement < m_options.min_improvement)
+            break;
+
+        auto& projection = *candidates[*best_candidate].projection;
+        patterns.push_back(projection.get_mapping().get_pattern());
+        collection_size += projection.get_forward().num_vertices();
+        projections.push_back(std::move(projection));
+        candidates.erase(candidates.begin() + *best_candidate);
+    }
+
+    return patterns;
+}
+
+}
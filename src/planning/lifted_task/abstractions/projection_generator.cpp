@@ -17,6 +17,8 @@
 
 #include "tyr/planning/lifted_task/abstractions/projection_generator.hpp"
 
+#include "projection_generator/action_costs.hpp"
+#include "projection_generator/projection_cache.hpp"
 #include "projection_generator/task_projection.hpp"
 #include "tyr/analysis/domains.hpp"
 #include "tyr/common/block_array_set.hpp"
@@ -46,11 +48,19 @@
 #include "tyr/planning/formatter.hpp"
 #include "tyr/planning/heuristics/blind.hpp"
 #include "tyr/planning/lifted_task.hpp"
+#include "tyr/planning/lifted_task/axiom_evaluator.hpp"
 #include "tyr/planning/lifted_task/node.hpp"
+#include "tyr/planning/lifted_task/state_repository.hpp"
 #include "tyr/planning/lifted_task/state_view.hpp"
 #include "tyr/planning/lifted_task/successor_generator.hpp"
 #include "tyr/planning/lifted_task/unpacked_state.hpp"
 
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
 namespace f = tyr::formalism;
 namespace fp = tyr::formalism::planning;
 namespace u = tyr::formalism::unification;
@@ -66,23 +76,121 @@ bool is_ground(const fp::MutableAtom<T>& atom)
     return std::all_of(atom.terms.begin(), atom.terms.end(), [](const auto& term) { return u::is_object(term); });
 }
 
+/// @brief Dense indices of ground atoms, interned by their predicate and objects.
+///
+/// Membership tests hash the atom once instead of comparing it against every atom of a list.
+/// Lookups hash and compare the atom against the stored keys directly, such that concurrent lookups share no buffer.
 template<f::FactKind T>
-bool contains_atom(const std::vector<fp::MutableAtom<T>>& atoms, const fp::MutableAtom<T>& atom)
+class GroundAtomIndex
 {
-    return std::find(atoms.begin(), atoms.end(), atom) != atoms.end();
-}
+public:
+    uint_t insert(const fp::MutableAtom<T>& atom)
+    {
+        if (const auto it = m_indices.find(atom); it != m_indices.end())
+            return it->second;
+
+        return m_indices.emplace(make_key(atom), uint_t(m_indices.size())).first->second;
+    }
+
+    std::optional<uint_t> find(const fp::MutableAtom<T>& atom) const
+    {
+        const auto it = m_indices.find(atom);
+        if (it == m_indices.end())
+            return std::nullopt;
+
+        return it->second;
+    }
+
+    bool contains(const fp::MutableAtom<T>& atom) const { return find(atom).has_value(); }
+
+private:
+    using Key = std::vector<uint_t>;
+
+    static Key make_key(const fp::MutableAtom<T>& atom)
+    {
+        assert(is_ground(atom));
+
+        auto key = Key {};
+        key.reserve(atom.terms.size() + 1);
+        key.push_back(uint_t(atom.predicate.get_index()));
+        for (const auto& term : atom.terms)
+            key.push_back(uint_t(u::get_object(term)));
+
+        return key;
+    }
+
+    /// The hash of an atom equals the hash of its key.
+    struct KeyHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(const Key& key) const noexcept
+        {
+            auto seed = key.size();
+            for (const auto value : key)
+                hash_combine(seed, value);
+            return seed;
+        }
+
+        size_t operator()(const fp::MutableAtom<T>& atom) const noexcept
+        {
+            assert(is_ground(atom));
+
+            auto seed = atom.terms.size() + 1;
+            hash_combine(seed, uint_t(atom.predicate.get_index()));
+            for (const auto& term : atom.terms)
+                hash_combine(seed, uint_t(u::get_object(term)));
+            return seed;
+        }
+    };
+
+    struct KeyEqual
+    {
+        using is_transparent = void;
+
+        bool operator()(const Key& lhs, const Key& rhs) const noexcept { return lhs == rhs; }
+
+        bool operator()(const Key& key, const fp::MutableAtom<T>& atom) const noexcept
+        {
+            if (key.size() != atom.terms.size() + 1 || key.front() != uint_t(atom.predicate.get_index()))
+                return false;
+
+            for (size_t i = 0; i < atom.terms.size(); ++i)
+                if (key[i + 1] != uint_t(u::get_object(atom.terms[i])))
+                    return false;
+
+            return true;
+        }
 
-std::vector<fp::MutableAtom<f::FluentTag>> difference_atoms(const std::vector<fp::MutableAtom<f::FluentTag>>& lhs,
-                                                            const std::vector<fp::MutableAtom<f::FluentTag>>& rhs)
+        bool operator()(const fp::MutableAtom<T>& atom, const Key& key) const noexcept { return (*this)(key, atom); }
+    };
+
+    gtl::flat_hash_map<Key, uint_t, KeyHash, KeyEqual> m_indices;
+};
+
+/// @brief The static atoms of the projected task, hashed for ground membership tests and grouped by predicate for matching.
+struct StaticAtoms
 {
-    auto result = std::vector<fp::MutableAtom<f::FluentTag>> {};
-    for (const auto& atom : lhs)
+    GroundAtomIndex<f::StaticTag> index;
+    std::vector<std::vector<fp::MutableAtom<f::StaticTag>>> atoms_by_predicate;
+
+    const std::vector<fp::MutableAtom<f::StaticTag>>& get_atoms(fp::PredicateView<f::StaticTag> predicate) const
     {
-        if (!contains_atom(rhs, atom))
-            result.push_back(atom);
+        static const auto empty = std::vector<fp::MutableAtom<f::StaticTag>> {};
+
+        const auto i = uint_t(predicate.get_index());
+        return (i < atoms_by_predicate.size()) ? atoms_by_predicate[i] : empty;
     }
-    return result;
-}
+};
+
+/// @brief The visible atoms of a pattern, where atom k corresponds to bit k of the masks that encode abstract states and atom sets.
+struct PatternAtoms
+{
+    GroundAtomIndex<f::FluentTag> index;
+    std::vector<fp::MutableAtom<f::FluentTag>> atoms;
+};
+
+bool test_atom(uint32_t mask, uint_t k) noexcept { return mask & (uint32_t(1) << k); }
 
 size_t compute_sigma_domain_size(const fp::MutableAction& action)
 {
@@ -143,56 +251,46 @@ u::SubstitutionFunction<Index<f::Object>> lift_substitution_to_original(const u:
     return result;
 }
 
-std::vector<fp::MutableAtom<f::StaticTag>> collect_projected_static_atoms(const Task<LiftedTag>& task)
+StaticAtoms collect_projected_static_atoms(const Task<LiftedTag>& task)
 {
-    auto result = std::vector<fp::MutableAtom<f::StaticTag>> {};
-    result.reserve(task.get_task().get_atoms<f::StaticTag>().size());
+    auto result = StaticAtoms {};
 
     for (const auto atom : task.get_task().get_atoms<f::StaticTag>())
-        result.emplace_back(atom);
-
-    return result;
-}
-
-std::vector<fp::MutableAtom<f::FluentTag>> collect_visible_fluent_atoms(const StateView<LiftedTag>& state, const Pattern& pattern)
-{
-    auto result = std::vector<fp::MutableAtom<f::FluentTag>> {};
-    result.reserve(pattern.facts_set.size());
-
-    for (const auto fact : pattern.facts_set)
     {
-        if (!state.get_unpacked_state().get(fact.get_variable()).is_none())
-            result.emplace_back(fact.get_atom().value());
+        auto mutable_atom = fp::MutableAtom<f::StaticTag>(atom);
+        result.index.insert(mutable_atom);
+
+        const auto i = uint_t(mutable_atom.predicate.get_index());
+        if (i >= result.atoms_by_predicate.size())
+            result.atoms_by_predicate.resize(i + 1);
+        result.atoms_by_predicate[i].push_back(std::move(mutable_atom));
     }
 
     return result;
 }
 
-std::vector<fp::MutableAtom<f::FluentTag>> collect_pattern_atoms(const Pattern& pattern)
+PatternAtoms collect_pattern_atoms(const Pattern& pattern)
 {
-    auto result = std::vector<fp::MutableAtom<f::FluentTag>> {};
-    result.reserve(pattern.atoms_set.size());
+    auto result = PatternAtoms {};
+    result.atoms.reserve(pattern.atoms_set.size());
 
     for (const auto atom : pattern.atoms_set)
-        result.emplace_back(atom);
+    {
+        result.atoms.emplace_back(atom);
+        [[maybe_unused]] const auto k = result.index.insert(result.atoms.back());
+        assert(k + 1 == result.atoms.size());
+    }
 
-    return result;
-}
+    // The abstract states and atom sets are encoded as masks over the pattern atoms.
+    if (result.atoms.size() > 32)
+        throw std::runtime_error("collect_pattern_atoms(...): patterns with more than 32 atoms are not supported.");
 
-bool is_visible_atom(const fp::MutableAtom<f::FluentTag>& atom, const std::vector<fp::MutableAtom<f::FluentTag>>& visible_atoms)
-{
-    return contains_atom(visible_atoms, atom);
+    return result;
 }
 
-template<f::FactKind T>
-bool literal_holds(const fp::MutableLiteral<T>& lit, const std::vector<fp::MutableAtom<T>>& atoms)
+bool literal_holds(const fp::MutableLiteral<f::StaticTag>& lit, const StaticAtoms& static_atoms)
 {
-    assert(is_ground(lit.atom));
-
-    if (lit.polarity)
-        return contains_atom(atoms, lit.atom);
-
-    return !contains_atom(atoms, lit.atom);
+    return static_atoms.index.contains(lit.atom) == lit.polarity;
 }
 
 template<f::FactKind T>
@@ -203,20 +301,6 @@ match_literal_to_atom(const fp::MutableLiteral<T>& lit, const fp::MutableAtom<T>
     return u::match(lit, target_lit, std::move(sigma));
 }
 
-bool same_atom_set(const std::vector<fp::MutableAtom<f::FluentTag>>& lhs, const std::vector<fp::MutableAtom<f::FluentTag>>& rhs)
-{
-    if (lhs.size() != rhs.size())
-        return false;
-
-    return std::all_of(lhs.begin(), lhs.end(), [&](const auto& atom) { return contains_atom(rhs, atom); });
-}
-
-void push_unique(std::vector<fp::MutableAtom<f::FluentTag>>& atoms, const fp::MutableAtom<f::FluentTag>& atom)
-{
-    if (!contains_atom(atoms, atom))
-        atoms.push_back(atom);
-}
-
 /**
  * Static literal satisfaction
  *
@@ -225,7 +309,7 @@ void push_unique(std::vector<fp::MutableAtom<f::FluentTag>>& atoms, const fp::Mu
 template<typename Callback>
 void satisfy_static_literals_rec(const fp::MutableLiteralList<f::StaticTag>& static_literals,
                                  size_t pos,
-                                 const std::vector<fp::MutableAtom<f::StaticTag>>& static_atoms,
+                                 const StaticAtoms& static_atoms,
                                  const u::SubstitutionFunction<Data<f::Term>>& sigma,
                                  Callback&& callback)
 {
@@ -249,7 +333,7 @@ void satisfy_static_literals_rec(const fp::MutableLiteralList<f::StaticTag>& sta
     if (!lit.polarity)
         return;
 
-    for (const auto& atom : static_atoms)
+    for (const auto& atom : static_atoms.get_atoms(lit.atom.predicate))
     {
         auto sigma2 = sigma;
         const auto matched = match_literal_to_atom(lit, atom, std::move(sigma2));
@@ -267,8 +351,8 @@ void satisfy_static_literals_rec(const fp::MutableLiteralList<f::StaticTag>& sta
  * Hidden fluent literals remain existential and are ignored here.
  */
 bool visible_fluent_literals_hold_in_src(const fp::MutableLiteralList<f::FluentTag>& fluent_literals,
-                                         const std::vector<fp::MutableAtom<f::FluentTag>>& src_atoms,
-                                         const std::vector<fp::MutableAtom<f::FluentTag>>& visible_pattern_atoms,
+                                         uint32_t src_mask,
+                                         const PatternAtoms& pattern_atoms,
                                          const u::SubstitutionFunction<Data<f::Term>>& sigma)
 {
     for (const auto& lit0 : fluent_literals)
@@ -278,10 +362,11 @@ bool visible_fluent_literals_hold_in_src(const fp::MutableLiteralList<f::FluentT
         if (!is_ground(lit.atom))
             continue;  // hidden existential support
 
-        if (!is_visible_atom(lit.atom, visible_pattern_atoms))
+        const auto k = pattern_atoms.index.find(lit.atom);
+        if (!k)
             continue;  // not part of the abstraction
 
-        if (!literal_holds(lit, src_atoms))
+        if (test_atom(src_mask, *k) != lit.polarity)
             return false;
     }
 
@@ -296,9 +381,9 @@ bool visible_fluent_literals_hold_in_src(const fp::MutableLiteralList<f::FluentT
  */
 template<typename Callback>
 void satisfy_condition_bindings(const fp::MutableConjunctiveCondition& condition,
-                                const std::vector<fp::MutableAtom<f::StaticTag>>& static_atoms,
-                                const std::vector<fp::MutableAtom<f::FluentTag>>& src_atoms,
-                                const std::vector<fp::MutableAtom<f::FluentTag>>& visible_pattern_atoms,
+                                const StaticAtoms& static_atoms,
+                                uint32_t src_mask,
+                                const PatternAtoms& pattern_atoms,
                                 const u::SubstitutionFunction<Data<f::Term>>& sigma,
                                 Callback&& callback)
 {
@@ -308,7 +393,7 @@ void satisfy_condition_bindings(const fp::MutableConjunctiveCondition& condition
                                 sigma,
                                 [&](const u::SubstitutionFunction<Data<f::Term>>& sigma2)
                                 {
-                                    if (!visible_fluent_literals_hold_in_src(condition.fluent_literals, src_atoms, visible_pattern_atoms, sigma2))
+                                    if (!visible_fluent_literals_hold_in_src(condition.fluent_literals, src_mask, pattern_atoms, sigma2))
                                         return;
 
                                     callback(sigma2);
@@ -393,26 +478,23 @@ void unify_changes_rec(const fp::MutableAction& action,
 template<typename Callback>
 void enumerate_verified_bindings_rec(const fp::MutableAction& action,
                                      size_t effect_pos,
-                                     const std::vector<fp::MutableAtom<f::FluentTag>>& src_atoms,
-                                     const std::vector<fp::MutableAtom<f::FluentTag>>& dst_atoms,
-                                     const std::vector<fp::MutableAtom<f::FluentTag>>& added,
-                                     const std::vector<fp::MutableAtom<f::FluentTag>>& deleted,
-                                     const std::vector<fp::MutableAtom<f::FluentTag>>& visible_pattern_atoms,
-                                     const std::vector<fp::MutableAtom<f::StaticTag>>& static_atoms,
+                                     uint32_t src_mask,
+                                     uint32_t dst_mask,
+                                     uint32_t added_mask,
+                                     uint32_t deleted_mask,
+                                     const PatternAtoms& pattern_atoms,
+                                     const StaticAtoms& static_atoms,
                                      const u::SubstitutionFunction<Data<f::Term>>& sigma,
-                                     const std::vector<fp::MutableAtom<f::FluentTag>>& produced_add,
-                                     const std::vector<fp::MutableAtom<f::FluentTag>>& produced_del,
+                                     uint32_t produced_add,
+                                     uint32_t produced_del,
                                      Callback&& callback)
 {
     if (effect_pos == action.effects.size())
     {
-        if (!same_atom_set(produced_add, added))
+        if (produced_add != added_mask || produced_del != deleted_mask)
             return;
 
-        if (!same_atom_set(produced_del, deleted))
-            return;
-
-        if (produced_add.empty() && produced_del.empty())
+        if (produced_add == 0 && produced_del == 0)
             return;
 
         callback(sigma);
@@ -424,11 +506,11 @@ void enumerate_verified_bindings_rec(const fp::MutableAction& action,
     // Option 1: skip this effect (either it does not fire, or it only has hidden consequences).
     enumerate_verified_bindings_rec(action,
                                     effect_pos + 1,
-                                    src_atoms,
-                                    dst_atoms,
-                                    added,
-                                    deleted,
-                                    visible_pattern_atoms,
+                                    src_mask,
+                                    dst_mask,
+                                    added_mask,
+                                    deleted_mask,
+                                    pattern_atoms,
                                     static_atoms,
                                     sigma,
                                     produced_add,
@@ -438,8 +520,8 @@ void enumerate_verified_bindings_rec(const fp::MutableAction& action,
     // Option 2: satisfy the effect condition and realize its visible consequences.
     satisfy_condition_bindings(ceff.condition,
                                static_atoms,
-                               src_atoms,
-                               visible_pattern_atoms,
+                               src_mask,
+                               pattern_atoms,
                                sigma,
                                [&](const u::SubstitutionFunction<Data<f::Term>>& sigma_eff)
                                {
@@ -453,32 +535,26 @@ void enumerate_verified_bindings_rec(const fp::MutableAction& action,
                                        if (!is_ground(lit.atom))
                                            return;
 
-                                       if (!is_visible_atom(lit.atom, visible_pattern_atoms))
+                                       const auto k = pattern_atoms.index.find(lit.atom);
+                                       if (!k)
                                            continue;
 
-                                       if (lit.polarity)
-                                       {
-                                           if (!contains_atom(dst_atoms, lit.atom))
-                                               return;
+                                       if (test_atom(dst_mask, *k) != lit.polarity)
+                                           return;
 
-                                           push_unique(produced_add2, lit.atom);
-                                       }
+                                       if (lit.polarity)
+                                           produced_add2 |= (uint32_t(1) << *k);
                                        else
-                                       {
-                                           if (contains_atom(dst_atoms, lit.atom))
-                                               return;
-
-                                           push_unique(produced_del2, lit.atom);
-                                       }
+                                           produced_del2 |= (uint32_t(1) << *k);
                                    }
 
                                    enumerate_verified_bindings_rec(action,
                                                                    effect_pos + 1,
-                                                                   src_atoms,
-                                                                   dst_atoms,
-                                                                   added,
-                                                                   deleted,
-                                                                   visible_pattern_atoms,
+                                                                   src_mask,
+                                                                   dst_mask,
+                                                                   added_mask,
+                                                                   deleted_mask,
+                                                                   pattern_atoms,
                                                                    static_atoms,
                                                                    sigma_eff,
                                                                    produced_add2,
@@ -488,182 +564,285 @@ void enumerate_verified_bindings_rec(const fp::MutableAction& action,
 }
 
 /**
- * Enumerate all object substitutions for `action` that realize `src -> dst` over the pattern.
+ * Enumerate the effect-driven substitutions that explain the added/deleted visible atoms and satisfy the static literals of the action condition.
+ *
+ * The result only depends on the action and the (added, deleted) signature, and is therefore shared by all pairs of abstract states with that signature.
  */
-template<typename Callback>
-void for_each_unifier(fp::ActionView action,
-                      const StateView<LiftedTag>& src,
-                      const StateView<LiftedTag>& dst,
-                      const Task<LiftedTag>& task,
-                      const Pattern& pattern,
-                      Callback&& callback)
+std::vector<u::SubstitutionFunction<Data<f::Term>>> compute_change_bindings(const fp::MutableAction& action,
+                                                                            const std::vector<fp::MutableAtom<f::FluentTag>>& added,
+                                                                            const std::vector<fp::MutableAtom<f::FluentTag>>& deleted,
+                                                                            const StaticAtoms& static_atoms)
 {
-    const auto mutable_action = fp::MutableAction(action);
-
-    // Pattern-visible difference only.
-    const auto src_atoms = collect_visible_fluent_atoms(src, pattern);
-    const auto dst_atoms = collect_visible_fluent_atoms(dst, pattern);
-    const auto added = difference_atoms(dst_atoms, src_atoms);
-    const auto deleted = difference_atoms(src_atoms, dst_atoms);
-
-    const auto visible_pattern_atoms = collect_pattern_atoms(pattern);
-    const auto static_atoms = collect_projected_static_atoms(task);
-
-    auto seen = std::vector<u::SubstitutionFunction<Index<f::Object>>> {};
+    auto result = std::vector<u::SubstitutionFunction<Data<f::Term>>> {};
 
-    unify_changes_rec(mutable_action,
+    unify_changes_rec(action,
                       added,
                       deleted,
                       0,
                       0,
-                      make_sigma(mutable_action),
+                      make_sigma(action),
                       [&](const u::SubstitutionFunction<Data<f::Term>>& sigma0)
                       {
-                          satisfy_condition_bindings(mutable_action.condition,
-                                                     static_atoms,
-                                                     src_atoms,
-                                                     visible_pattern_atoms,
-                                                     sigma0,
-                                                     [&](const u::SubstitutionFunction<Data<f::Term>>& sigma1)
-                                                     {
-                                                         enumerate_verified_bindings_rec(mutable_action,
-                                                                                         0,
-                                                                                         src_atoms,
-                                                                                         dst_atoms,
-                                                                                         added,
-                                                                                         deleted,
-                                                                                         visible_pattern_atoms,
-                                                                                         static_atoms,
-                                                                                         sigma1,
-                                                                                         {},
-                                                                                         {},
-                                                                                         [&](const u::SubstitutionFunction<Data<f::Term>>& sigma_final)
-                                                                                         {
-                                                                                             const auto obj_sigma =
-                                                                                                 to_object_substitution(sigma_final, action.get_arity());
-                                                                                             if (!obj_sigma)
-                                                                                                 return;
-
-                                                                                            if (std::any_of(seen.begin(),
-                                                                                                            seen.end(),
-                                                                                                            [&](const auto& existing)
-                                                                                                            {
-                                                                                                                return EqualTo<
-                                                                                                                    u::SubstitutionFunction<Index<f::Object>>> {}(
-                                                                                                                    existing, *obj_sigma);
-                                                                                                            }))
-                                                                                                 return;
-
-                                                                                             seen.push_back(*obj_sigma);
-                                                                                             callback(*obj_sigma);
-                                                                                         });
-                                                     });
+                          satisfy_static_literals_rec(action.condition.static_literals,
+                                                      0,
+                                                      static_atoms,
+                                                      sigma0,
+                                                      [&](const u::SubstitutionFunction<Data<f::Term>>& sigma1) { result.push_back(sigma1); });
                       });
+
+    return result;
 }
 
-/// @brief Create all 2^|pattern| abstract states.
-/// This ignores reachability but suffices for domains without unsolvable states.
-auto create_abstract_states(const Pattern& pattern, Task<LiftedTag>& task, StateRepository<LiftedTag>& state_repository)
+/**
+ * Enumerate all object substitutions for `action` that realize `src -> dst` over the pattern,
+ * given the change bindings of the (added, deleted) signature of `src -> dst`.
+ */
+template<typename Callback>
+void for_each_unifier(fp::ActionView action,
+                      const fp::MutableAction& mutable_action,
+                      const std::vector<u::SubstitutionFunction<Data<f::Term>>>& change_bindings,
+                      uint32_t src_mask,
+                      uint32_t dst_mask,
+                      uint32_t added_mask,
+                      uint32_t deleted_mask,
+                      const PatternAtoms& pattern_atoms,
+                      const StaticAtoms& static_atoms,
+                      Callback&& callback)
 {
-    auto facts = std::vector<fp::FDRFactView<f::FluentTag>>(pattern.facts.begin(), pattern.facts.end());
-    auto astates = std::vector<StateView<LiftedTag>> {};
-    auto goal_vertices = std::vector<uint_t> {};
+    auto seen = std::vector<u::SubstitutionFunction<Index<f::Object>>> {};
 
+    for (const auto& sigma1 : change_bindings)
     {
-        itertools::for_each_boolean_vector(
-            [&](auto&& vec)
+        if (!visible_fluent_literals_hold_in_src(mutable_action.condition.fluent_literals, src_mask, pattern_atoms, sigma1))
+            continue;
+
+        enumerate_verified_bindings_rec(
+            mutable_action,
+            0,
+            src_mask,
+            dst_mask,
+            added_mask,
+            deleted_mask,
+            pattern_atoms,
+            static_atoms,
+            sigma1,
+            0,
+            0,
+            [&](const u::SubstitutionFunction<Data<f::Term>>& sigma_final)
             {
-                auto uastate = state_repository.get_unregistered_state();
-                uastate->clear();
+                const auto obj_sigma = to_object_substitution(sigma_final, action.get_arity());
+                if (!obj_sigma)
+                    return;
+
+                if (std::any_of(seen.begin(),
+                                seen.end(),
+                                [&](const auto& existing) { return EqualTo<u::SubstitutionFunction<Index<f::Object>>> {}(existing, *obj_sigma); }))
+                    return;
+
+                seen.push_back(*obj_sigma);
+                callback(*obj_sigma);
+            });
+    }
+}
 
-                for (uint_t i = 0; i < vec.size(); ++i)
-                    if (vec[i])
-                        uastate->set(facts[i].get_data());
+/// @brief Create the abstract states of the mapping, i.e., the mutex-consistent assignments to the pattern facts, indexed by their rank.
+/// This ignores reachability but suffices for domains without unsolvable states.
+/// The states are not registered: the visible atoms of each abstract state are returned as masks over the pattern atoms, together with the ranks of the goal states.
+auto create_abstract_states(const ProjectionMapping<LiftedTag>& mapping,
+                            const PatternAtoms& pattern_atoms,
+                            Task<LiftedTag>& task,
+                            StateRepository<LiftedTag>& state_repository)
+{
+    const auto& pattern = mapping.get_pattern();
 
-                const auto astate = state_repository.register_state(uastate);
-                const auto state_context = StateContext { task, astate.get_unpacked_state(), float_t { 0 } };
-                const auto is_goal = is_dynamically_applicable(task.get_task().get_goal(), state_context);
+    auto astate_masks = std::vector<uint32_t> {};
+    auto goal_vertices = std::vector<uint_t> {};
+    astate_masks.reserve(mapping.num_abstract_states());
 
-                if (is_goal)
-                    goal_vertices.push_back(uint_t(astate.get_index()));
+    auto uastate = state_repository.get_unregistered_state();
 
-                astates.push_back(astate);
-            },
-            pattern.size());
+    for (uint_t r = 0; r < mapping.num_abstract_states(); ++r)
+    {
+        auto mask = uint32_t(0);
+        uastate->clear();
+
+        mapping.for_each_fact(r,
+                              [&](uint_t i)
+                              {
+                                  const auto fact = pattern.facts[i];
+                                  uastate->set(fact.get_data());
+                                  if (const auto k = pattern_atoms.index.find(fp::MutableAtom<f::FluentTag>(fact.get_atom().value())))
+                                      mask |= (uint32_t(1) << *k);
+                              });
+
+        if (const auto& axiom_evaluator = state_repository.get_axiom_evaluator())
+            axiom_evaluator->compute_extended_state(*uastate);
+
+        const auto state_context = StateContext { task, *uastate, float_t { 0 } };
+        if (is_dynamically_applicable(task.get_task().get_goal(), state_context))
+            goal_vertices.push_back(r);
+
+        astate_masks.push_back(mask);
     }
 
-    return std::make_pair(std::move(astates), std::move(goal_vertices));
+    return std::make_pair(std::move(astate_masks), std::move(goal_vertices));
 }
 
-auto create_abstract_state_changing_transitions(const std::vector<StateView<LiftedTag>>& astates,
-                                                const Pattern& pattern,
+/// @brief The state-independent data of a projected action for the unifier enumeration.
+struct ProjectedActionContext
+{
+    fp::ActionView projected_action;
+    const ProjectionMapping<LiftedTag>::ProjectedActionInfo* info;
+    fp::MutableAction mutable_action;
+
+    /// Change bindings memoized by the (added, deleted) signature, see `get_signature`.
+    UnorderedMap<uint64_t, std::vector<u::SubstitutionFunction<Data<f::Term>>>> change_bindings;
+};
+
+uint64_t get_signature(uint32_t added_mask, uint32_t deleted_mask) noexcept { return (uint64_t(added_mask) << 32) | deleted_mask; }
+
+std::vector<fp::MutableAtom<f::FluentTag>> get_masked_atoms(const std::vector<fp::MutableAtom<f::FluentTag>>& atoms, uint32_t mask)
+{
+    auto result = std::vector<fp::MutableAtom<f::FluentTag>> {};
+    for (uint_t i = 0; i < atoms.size(); ++i)
+        if (test_atom(mask, i))
+            result.push_back(atoms[i]);
+    return result;
+}
+
+auto create_abstract_state_changing_transitions(const std::vector<uint32_t>& astate_masks,
+                                                const PatternAtoms& pattern_atoms,
                                                 const ProjectionMapping<LiftedTag>::ActionMapping& projected_to_original_action,
                                                 Task<LiftedTag>& task)
 {
-    auto labeled_succ_nodes = std::vector<LabeledNode<LiftedTag>> {};
+    const auto num_astates = uint_t(astate_masks.size());
+
+    auto labels = TransitionLabelList {};
     auto transitions = TransitionList {};
-    auto adj_lists = std::vector<std::vector<uint_t>>(astates.size());
 
-    for (size_t i = 0; i < astates.size(); ++i)
-    {
-        const auto& astate_i = astates[i];
+    // The labels are interned by the projected action and the objects of the substitution, where unbound parameters are none.
+    auto label_indices = UnorderedMap<std::vector<uint_t>, uint_t> {};
+    auto label_key = std::vector<uint_t> {};
 
-        for (size_t j = 0; j < astates.size(); ++j)
+    // Everything that does not depend on the pair of abstract states is computed once.
+    const auto static_atoms = collect_projected_static_atoms(task);
+
+    auto actions = std::vector<ProjectedActionContext> {};
+    actions.reserve(projected_to_original_action.size());
+    for (const auto& [projected_action, info] : projected_to_original_action)
+        actions.push_back(ProjectedActionContext { projected_action, &info, fp::MutableAction(projected_action), {} });
+
+    for (uint_t i = 0; i < num_astates; ++i)
+    {
+        for (uint_t j = 0; j < num_astates; ++j)
         {
             if (i == j)
                 continue;
 
-            const auto& astate_j = astates[j];
+            // Pattern-visible difference only.
+            const auto added_mask = astate_masks[j] & ~astate_masks[i];
+            const auto deleted_mask = astate_masks[i] & ~astate_masks[j];
+            const auto signature = get_signature(added_mask, deleted_mask);
+            const auto added = get_masked_atoms(pattern_atoms.atoms, added_mask);
+            const auto deleted = get_masked_atoms(pattern_atoms.atoms, deleted_mask);
 
-            for (const auto& [projected_action, info] : projected_to_original_action)
+            for (auto& action : actions)
             {
-                for_each_unifier(projected_action,
-                                 astate_i,
-                                 astate_j,
-                                 task,
-                                 pattern,
-                                 [&](const u::SubstitutionFunction<Index<f::Object>>& sigma_projected)
-                                 {
-                                     const auto sigma_original =
-                                         lift_substitution_to_original(sigma_projected, info.original_action.get_arity(), info.projected_to_original);
+                auto it = action.change_bindings.find(signature);
+                if (it == action.change_bindings.end())
+                    it = action.change_bindings.emplace(signature, compute_change_bindings(action.mutable_action, added, deleted, static_atoms)).first;
 
-                                     const auto t = uint_t(transitions.size());
-                                     const auto src = uint_t(astate_i.get_index());
-                                     const auto dst = uint_t(astate_j.get_index());
+                if (it->second.empty())
+                    continue;
 
-                                     transitions.push_back(Transition { projected_action, info.original_action, sigma_original, src, dst });
-                                     adj_lists[src].push_back(t);
+                for_each_unifier(action.projected_action,
+                                 action.mutable_action,
+                                 it->second,
+                                 astate_masks[i],
+                                 astate_masks[j],
+                                 added_mask,
+                                 deleted_mask,
+                                 pattern_atoms,
+                                 static_atoms,
+                                 [&](const u::SubstitutionFunction<Index<f::Object>>& sigma_projected)
+                                 {
+                                     const auto sigma_original = lift_substitution_to_original(sigma_projected,
+                                                                                               action.info->original_action.get_arity(),
+                                                                                               action.info->projected_to_original);
+
+                                     label_key.clear();
+                                     label_key.push_back(uint_t(action.projected_action.get_index()));
+                                     for (uint_t p = 0; p < action.info->original_action.get_arity(); ++p)
+                                     {
+                                         const auto& object = sigma_original[f::ParameterIndex { p }];
+                                         label_key.push_back(object.has_value() ? uint_t(*object) : std::numeric_limits<uint_t>::max());
+                                     }
+
+                                     const auto [it, inserted] = label_indices.emplace(label_key, uint_t(labels.size()));
+                                     if (inserted)
+                                         labels.push_back(TransitionLabel { action.projected_action, action.info->original_action, sigma_original });
+
+                                     transitions.push_back(Transition { i, j, it->second });
                                  });
             }
         }
     }
 
-    return std::make_pair(std::move(transitions), std::move(adj_lists));
+    return std::make_pair(std::move(labels), std::move(transitions));
 }
 
-auto create_projection(const Pattern& pattern, const Task<LiftedTag>& original_task)
+ProjectionAbstraction<LiftedTag> create_projection(const Pattern& pattern,
+                                                   const Task<LiftedTag>& original_task,
+                                                   const ActionCosts& action_costs,
+                                                   const ProjectionGeneratorOptions& options,
+                                                   const ProjectionCache* cache,
+                                                   ProjectionGeneratorStatistics& statistics)
 {
     auto [projected_task, projected_to_original_action] = project_task(original_task, pattern);
 
+    auto mapping = ProjectionMapping<LiftedTag>(pattern, options.mutex_groups);
+
+    auto key = uint64_t(0);
+    if (cache)
+    {
+        key = cache->compute_key(mapping);
+        if (auto projection = cache->load(key, mapping, projected_to_original_action, action_costs))
+        {
+            ++statistics.num_loaded_projections;
+            return std::move(*projection);
+        }
+    }
+
+    // The repository only provides the unpacked state and the axiom evaluator, no abstract state is registered.
     auto state_repository = StateRepository<LiftedTag>::create(projected_task, ExecutionContext::create(1));
 
-    auto [astates, goal_vertices] = create_abstract_states(pattern, *projected_task, *state_repository);
-    auto [transitions, adj_lists] = create_abstract_state_changing_transitions(astates, pattern, projected_to_original_action, *projected_task);
+    const auto pattern_atoms = collect_pattern_atoms(pattern);
+
+    auto [astate_masks, goal_vertices] = create_abstract_states(mapping, pattern_atoms, *projected_task, *state_repository);
+    auto [labels, transitions] = create_abstract_state_changing_transitions(astate_masks, pattern_atoms, projected_to_original_action, *projected_task);
 
-    auto result = ProjectionAbstraction(std::make_shared<const ForwardProjectionAbstraction<LiftedTag>>(ProjectionMapping<LiftedTag>(pattern),
-                                                                                                        std::move(state_repository),
-                                                                                                        std::move(astates),
-                                                                                                        std::move(transitions),
-                                                                                                        std::move(adj_lists),
-                                                                                                        std::move(goal_vertices)));
+    auto label_costs = get_label_costs(labels, action_costs);
+
+    auto result = ProjectionAbstraction(std::make_shared<const ForwardProjectionAbstraction<LiftedTag>>(std::move(mapping),
+                                                                                                        std::move(labels),
+                                                                                                        transitions,
+                                                                                                        std::move(goal_vertices)),
+                                        std::move(label_costs));
+
+    if (cache && cache->store(key, result))
+        ++statistics.num_stored_projections;
 
     return result;
 }
 }
 
-ProjectionGenerator<LiftedTag>::ProjectionGenerator(std::shared_ptr<const Task<LiftedTag>> task, PatternCollection patterns) :
+ProjectionGenerator<LiftedTag>::ProjectionGenerator(std::shared_ptr<const Task<LiftedTag>> task,
+                                                    PatternCollection patterns,
+                                                    ProjectionGeneratorOptions options) :
     m_task(std::move(task)),
-    m_patterns(std::move(patterns))
+    m_patterns(std::move(patterns)),
+    m_options(std::move(options)),
+    m_statistics()
 {
 }
 
@@ -671,8 +850,14 @@ ProjectionAbstractionList<LiftedTag> ProjectionGenerator<LiftedTag>::generate()
 {
     auto projections = ProjectionAbstractionList<LiftedTag> {};
 
+    auto cache = std::optional<ProjectionCache> {};
+    if (m_options.cache_directory)
+        cache.emplace(*m_options.cache_directory, *m_task);
+
+    const auto action_costs = compute_action_costs(*m_task);
+
     for (const auto& pattern : m_patterns)
-        projections.push_back(create_projection(pattern, *m_task));
+        projections.push_back(create_projection(pattern, *m_task, action_costs, m_options, cache ? &*cache : nullptr, m_statistics));
 
     return projections;
 }
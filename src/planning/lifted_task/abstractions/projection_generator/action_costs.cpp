@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "action_costs.hpp"
+
+#include "tyr/common/equal_to.hpp"
+#include "tyr/common/hash.hpp"
+#include "tyr/planning/lifted_task.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::planning
+{
+namespace
+{
+
+using MinStaticValues = UnorderedMap<uint_t, float_t>;  ///< the smallest value of each static function, by index
+
+constexpr auto unbounded = -std::numeric_limits<float_t>::infinity();
+
+/// @brief Compute a lower bound on the value of a lifted function expression over all groundings, or -infinity if there is none.
+template<typename Expression>
+float_t compute_lower_bound(Expression element, const MinStaticValues& min_static_values)
+{
+    if constexpr (std::is_same_v<Expression, float_t>)
+    {
+        return element;
+    }
+    else if constexpr (requires { element.get_variant(); })
+    {
+        return visit([&](auto&& arg) { return compute_lower_bound(arg, min_static_values); }, element.get_variant());
+    }
+    else if constexpr (requires { typename Expression::OpType; element.get_arg(); })
+    {
+        return unbounded;
+    }
+    else if constexpr (requires { typename Expression::OpType; element.get_lhs(); })
+    {
+        using Op = typename Expression::OpType;
+
+        const auto lhs = compute_lower_bound(element.get_lhs(), min_static_values);
+        const auto rhs = compute_lower_bound(element.get_rhs(), min_static_values);
+
+        if constexpr (std::is_same_v<Op, f::OpAdd>)
+            return lhs + rhs;
+        else if constexpr (std::is_same_v<Op, f::OpMul>)
+            return (lhs >= 0 && rhs >= 0) ? lhs * rhs : unbounded;
+        else
+            return unbounded;
+    }
+    else if constexpr (requires { typename Expression::OpType; element.get_args(); })
+    {
+        using Op = typename Expression::OpType;
+
+        if constexpr (std::is_same_v<Op, f::OpAdd> || std::is_same_v<Op, f::OpMul>)
+        {
+            auto result = std::is_same_v<Op, f::OpAdd> ? float_t { 0 } : float_t { 1 };
+            for (const auto arg : element.get_args())
+            {
+                const auto value = compute_lower_bound(arg, min_static_values);
+                if constexpr (std::is_same_v<Op, f::OpAdd>)
+                    result += value;
+                else if (value < 0 || result < 0)
+                    return unbounded;
+                else
+                    result *= value;
+            }
+            return result;
+        }
+        else
+        {
+            return unbounded;
+        }
+    }
+    else if constexpr (std::is_same_v<decltype(element.get_index()), Index<fp::FunctionTerm<f::StaticTag>>>)
+    {
+        const auto it = min_static_values.find(uint_t(element.get_function().get_index()));
+        return it != min_static_values.end() ? it->second : unbounded;
+    }
+    else
+    {
+        return unbounded;
+    }
+}
+
+}
+
+ActionCosts compute_action_costs(const Task<LiftedTag>& task)
+{
+    auto result = ActionCosts {};
+
+    const auto actions = task.get_domain().get_domain().get_actions();
+
+    if (!task.get_task().get_metric())
+    {
+        for (const auto action : actions)
+            result.emplace(action, float_t { 1 });
+        return result;
+    }
+
+    auto min_static_values = MinStaticValues {};
+    for (const auto fterm_value : task.get_task().get_fterm_values<f::StaticTag>())
+    {
+        const auto [it, inserted] = min_static_values.emplace(uint_t(fterm_value.get_fterm().get_function().get_index()), fterm_value.get_value());
+        if (!inserted)
+            it->second = std::min(it->second, fterm_value.get_value());
+    }
+
+    for (const auto action : actions)
+    {
+        auto cost = float_t { 0 };
+
+        for (const auto cond_effect : action.get_effects())
+        {
+            // Only the effects that occur in every ground action of the schema contribute.
+            const auto condition = cond_effect.get_condition();
+            if (cond_effect.get_arity() > 0 || !condition.get_literals<f::StaticTag>().empty() || !condition.get_literals<f::FluentTag>().empty()
+                || !condition.get_literals<f::DerivedTag>().empty() || !condition.get_numeric_constraints().empty())
+                continue;
+
+            const auto increase = cond_effect.get_effect().get_auxiliary_numeric_effect();
+            if (increase.has_value())
+                cost += std::max(float_t { 0 }, compute_lower_bound(increase.value().get_fexpr(), min_static_values));
+        }
+
+        result.emplace(action, cost);
+    }
+
+    return result;
+}
+
+std::vector<float_t> get_label_costs(const TransitionLabelList& labels, const ActionCosts& action_costs)
+{
+    auto result = std::vector<float_t> {};
+    result.reserve(labels.size());
+    for (const auto& label : labels)
+        result.push_back(action_costs.at(label.original_action));
+    return result;
+}
+
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_SRC_PLANNING_LIFTED_TASK_ABSTRACTIONS_PROJECTION_GENERATOR_ACTION_COSTS_HPP_
+#define TYR_SRC_PLANNING_LIFTED_TASK_ABSTRACTIONS_PROJECTION_GENERATOR_ACTION_COSTS_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/common/declarations.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/formalism/planning/views.hpp"
+#include "tyr/planning/abstractions/explicit_projection.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <vector>
+
+namespace tyr::planning
+{
+
+using ActionCosts = UnorderedMap<formalism::planning::ActionView, float_t>;
+
+/// @brief Compute a lower bound on the cost of the ground actions of each action schema.
+///
+/// Without a metric, all actions have unit cost. Otherwise, the cost of an action is the increase of the total cost by its unconditional effects,
+/// bounded from below over all groundings: static function terms by the smallest value of their function, and fluent function terms by zero.
+ActionCosts compute_action_costs(const Task<LiftedTag>& task);
+
+std::vector<float_t> get_label_costs(const TransitionLabelList& labels, const ActionCosts& action_costs);
+
+}
+
+#endif
@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "projection_cache.hpp"
+
+#include "tyr/common/formatter.hpp"
+#include "tyr/formalism/planning/formatter.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/formalism/planning/views.hpp"
+#include "tyr/planning/lifted_task.hpp"
+
+#include <cassert>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+namespace u = tyr::formalism::unification;
+
+namespace tyr::planning
+{
+namespace
+{
+
+/// "TYRPDB" followed by the version of the file format.
+///
+/// Version 3 stores the label costs under which the distances were computed. Files of version 2 contain unit-cost distances.
+constexpr uint64_t magic = 0x0003'4244'5052'5954;
+
+constexpr uint32_t unbound_object = std::numeric_limits<uint32_t>::max();
+
+struct FileHeader
+{
+    uint64_t magic;
+    uint64_t key;
+    uint64_t num_abstract_states;
+    uint64_t num_goal_vertices;
+    uint64_t num_labels;
+    uint64_t num_transitions;
+    uint64_t num_substitution_values;
+};
+
+struct LabelRecord
+{
+    uint32_t original_action;
+    uint32_t substitution_begin;  ///< the arity of the original action determines the end
+};
+
+struct TransitionRecord
+{
+    uint32_t src;
+    uint32_t dst;
+    uint32_t label;
+};
+
+/// @brief 64-bit FNV-1a, which, unlike std::hash, is stable across platforms and runs.
+class StableHash
+{
+public:
+    void update(const void* data, size_t size) noexcept
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            m_value ^= bytes[i];
+            m_value *= 0x0000'0100'0000'01B3;
+        }
+    }
+
+    void update(std::string_view str) noexcept
+    {
+        update(str.data(), str.size());
+        update(uint64_t(str.size()));
+    }
+
+    void update(uint64_t value) noexcept { update(&value, sizeof(value)); }
+
+    uint64_t get() const noexcept { return m_value; }
+
+private:
+    uint64_t m_value = 0xCBF2'9CE4'8422'2325;
+};
+
+constexpr size_t get_padding(size_t num_bytes) noexcept { return (8 - num_bytes % 8) % 8; }
+
+template<typename T>
+void write_array(std::ofstream& out, const std::vector<T>& values)
+{
+    static constexpr char zeros[8] = {};
+
+    const auto num_bytes = values.size() * sizeof(T);
+    out.write(reinterpret_cast<const char*>(values.data()), num_bytes);
+    out.write(zeros, get_padding(num_bytes));
+}
+
+/// @brief Return whether the arrays announced by the header exactly fill a file of the given size.
+///
+/// The counts of a corrupt or truncated file are thereby rejected before any array is allocated.
+bool has_consistent_size(const FileHeader& header, uint64_t file_size) noexcept
+{
+    auto expected_size = uint64_t(sizeof(FileHeader));
+
+    const auto add_array = [&](uint64_t count, uint64_t record_size)
+    {
+        if (count > file_size / record_size)
+            return false;
+
+        const auto num_bytes = count * record_size;
+        expected_size += num_bytes + get_padding(num_bytes);
+        return expected_size <= file_size;
+    };
+
+    return add_array(header.num_goal_vertices, sizeof(uint32_t)) && add_array(header.num_labels, sizeof(LabelRecord))
+           && add_array(header.num_transitions, sizeof(TransitionRecord)) && add_array(header.num_substitution_values, sizeof(uint32_t))
+           && add_array(header.num_abstract_states, sizeof(float_t)) && add_array(header.num_labels, sizeof(float_t)) && expected_size == file_size;
+}
+
+template<typename T>
+bool read_array(std::ifstream& in, std::vector<T>& values, size_t size)
+{
+    char padding[8];
+
+    values.resize(size);
+    const auto num_bytes = size * sizeof(T);
+    in.read(reinterpret_cast<char*>(values.data()), num_bytes);
+    in.read(padding, get_padding(num_bytes));
+    return bool(in);
+}
+
+}
+
+ProjectionCache::ProjectionCache(std::filesystem::path directory, const Task<LiftedTag>& task) : m_directory(std::move(directory)), m_task_hash()
+{
+    auto hash = StableHash();
+    hash.update(to_string(task.get_domain().get_domain()));
+    hash.update(to_string(task.get_task()));
+    m_task_hash = hash.get();
+}
+
+uint64_t ProjectionCache::compute_key(const ProjectionMapping<LiftedTag>& mapping) const
+{
+    auto hash = StableHash();
+    hash.update(m_task_hash);
+
+    const auto& pattern = mapping.get_pattern();
+    hash.update(uint64_t(pattern.size()));
+    for (const auto fact : pattern.facts)
+        hash.update(to_string(fact.get_atom().value()));
+
+    // The grouping determines the ranks of the abstract states.
+    for (const auto& group : mapping.get_groups())
+    {
+        hash.update(uint64_t(group.positions.size()));
+        for (const auto i : group.positions)
+            hash.update(uint64_t(i));
+    }
+
+    return hash.get();
+}
+
+std::filesystem::path ProjectionCache::get_path(uint64_t key) const { return m_directory / fmt::format("{:016x}.pdb", key); }
+
+std::optional<ProjectionAbstraction<LiftedTag>> ProjectionCache::load(uint64_t key,
+                                                                      ProjectionMapping<LiftedTag> mapping,
+                                                                      const ProjectionMapping<LiftedTag>::ActionMapping& projected_to_original_action,
+                                                                      const ActionCosts& action_costs) const
+{
+    const auto path = get_path(key);
+
+    auto in = std::ifstream(path, std::ios::binary);
+    if (!in)
+        return std::nullopt;
+
+    auto ec = std::error_code {};
+    const auto file_size = std::filesystem::file_size(path, ec);
+    if (ec)
+        return std::nullopt;
+
+    auto header = FileHeader {};
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in || header.magic != magic || header.key != key || header.num_abstract_states != mapping.num_abstract_states()
+        || !has_consistent_size(header, file_size))
+        return std::nullopt;
+
+    auto goal_vertices = std::vector<uint32_t> {};
+    auto label_records = std::vector<LabelRecord> {};
+    auto transition_records = std::vector<TransitionRecord> {};
+    auto substitution_values = std::vector<uint32_t> {};
+    auto distances = std::vector<float_t> {};
+    auto stored_label_costs = std::vector<float_t> {};
+    if (!read_array(in, goal_vertices, header.num_goal_vertices) || !read_array(in, label_records, header.num_labels)
+        || !read_array(in, transition_records, header.num_transitions) || !read_array(in, substitution_values, header.num_substitution_values)
+        || !read_array(in, distances, header.num_abstract_states) || !read_array(in, stored_label_costs, header.num_labels))
+        return std::nullopt;
+
+    auto actions_by_original_index = UnorderedMap<uint_t, std::pair<fp::ActionView, fp::ActionView>> {};
+    for (const auto& [projected_action, info] : projected_to_original_action)
+        actions_by_original_index.emplace(uint_t(info.original_action.get_index()), std::make_pair(projected_action, info.original_action));
+
+    auto labels = TransitionLabelList {};
+    labels.reserve(label_records.size());
+
+    for (const auto& record : label_records)
+    {
+        const auto it = actions_by_original_index.find(record.original_action);
+        if (it == actions_by_original_index.end())
+            return std::nullopt;
+
+        const auto [projected_action, original_action] = it->second;
+        const auto arity = original_action.get_arity();
+        if (uint64_t(record.substitution_begin) + arity > substitution_values.size())
+            return std::nullopt;
+
+        auto substitution = u::SubstitutionFunction<Index<f::Object>>::from_range(f::ParameterIndex { 0 }, arity);
+        for (uint_t i = 0; i < arity; ++i)
+        {
+            const auto object = substitution_values[record.substitution_begin + i];
+            if (object == unbound_object)
+                continue;
+
+            [[maybe_unused]] const auto inserted = substitution.assign(f::ParameterIndex { i }, Index<f::Object>(object));
+            assert(inserted);
+        }
+
+        labels.push_back(TransitionLabel { projected_action, original_action, std::move(substitution) });
+    }
+
+    auto transitions = TransitionList {};
+    transitions.reserve(transition_records.size());
+
+    for (const auto& record : transition_records)
+    {
+        if (record.src >= header.num_abstract_states || record.dst >= header.num_abstract_states || record.label >= labels.size())
+            return std::nullopt;
+
+        transitions.push_back(Transition { record.src, record.dst, record.label });
+    }
+
+    // The distances are only valid under the costs they were computed with.
+    auto label_costs = get_label_costs(labels, action_costs);
+    if (label_costs != stored_label_costs)
+        return std::nullopt;
+
+    auto forward = std::make_shared<const ForwardProjectionAbstraction<LiftedTag>>(std::move(mapping),
+                                                                                   std::move(labels),
+                                                                                   transitions,
+                                                                                   std::vector<uint_t>(goal_vertices.begin(), goal_vertices.end()));
+
+    return ProjectionAbstraction<LiftedTag>(std::move(forward), std::move(label_costs), std::make_shared<const DistanceTable>(distances));
+}
+
+bool ProjectionCache::store(uint64_t key, const ProjectionAbstraction<LiftedTag>& projection) const
+{
+    const auto& forward = projection.get_forward();
+    const auto& table = *projection.get_distances();
+
+    auto goal_vertices = std::vector<uint32_t>(forward.goal_vertices().begin(), forward.goal_vertices().end());
+    auto label_records = std::vector<LabelRecord> {};
+    auto transition_records = std::vector<TransitionRecord> {};
+    auto substitution_values = std::vector<uint32_t> {};
+    auto distances = std::vector<float_t>(table.size());
+    label_records.reserve(forward.labels().size());
+    transition_records.reserve(forward.num_edges());
+
+    for (const auto& label : forward.labels())
+    {
+        label_records.push_back(LabelRecord { uint_t(label.original_action.get_index()), uint32_t(substitution_values.size()) });
+
+        for (uint_t i = 0; i < label.original_action.get_arity(); ++i)
+        {
+            const auto& object = label.substitution[f::ParameterIndex { i }];
+            substitution_values.push_back(object.has_value() ? uint_t(*object) : unbound_object);
+        }
+    }
+
+    for (uint_t v = 0; v < forward.num_vertices(); ++v)
+        for (const auto t : forward.get_transitions(v))
+            transition_records.push_back(TransitionRecord { v, forward.get_target(t), forward.get_label_index(t) });
+
+    for (uint_t i = 0; i < table.size(); ++i)
+        distances[i] = table[i];
+
+    const auto header = FileHeader {
+        magic, key, forward.num_vertices(), goal_vertices.size(), label_records.size(), transition_records.size(), substitution_values.size()
+    };
+
+    auto ec = std::error_code {};
+    std::filesystem::create_directories(m_directory, ec);
+    if (ec)
+        return false;
+
+    const auto path = get_path(key);
+    auto tmp_path = path;
+    tmp_path += fmt::format(".{:016x}.tmp", std::random_device {}());
+
+    {
+        auto out = std::ofstream(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        write_array(out, goal_vertices);
+        write_array(out, label_records);
+        write_array(out, transition_records);
+        write_array(out, substitution_values);
+        write_array(out, distances);
+        write_array(out, projection.get_label_costs());
+
+        if (!out)
+        {
+            out.close();
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+
+    return true;
+}
+
+}
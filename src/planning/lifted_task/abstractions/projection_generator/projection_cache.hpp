@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_SRC_PLANNING_LIFTED_TASK_ABSTRACTIONS_PROJECTION_GENERATOR_PROJECTION_CACHE_HPP_
+#define TYR_SRC_PLANNING_LIFTED_TASK_ABSTRACTIONS_PROJECTION_GENERATOR_PROJECTION_CACHE_HPP_
+
+#include "action_costs.hpp"
+
+#include "tyr/planning/abstractions/explicit_projection.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+namespace tyr::planning
+{
+
+/// @brief A directory of projections, i.e., their transitions, goal states, goal distances and label costs, that were generated in previous runs.
+///
+/// A projection is stored in a file named after a stable hash of the textual representation of the domain and task,
+/// the pattern, and the grouping of the pattern facts. The file consists of a fixed header and 8-byte aligned arrays of fixed-width
+/// records. Files are written to a temporary file and renamed, such that concurrent runs never read partially written files.
+/// A file that cannot be read or does not match, including one whose label costs differ from the current ones, is ignored.
+class ProjectionCache
+{
+public:
+    ProjectionCache(std::filesystem::path directory, const Task<LiftedTag>& task);
+
+    uint64_t compute_key(const ProjectionMapping<LiftedTag>& mapping) const;
+
+    /// @brief Load the projection with the given key.
+    /// @param projected_to_original_action resolves the original actions of the stored transitions to the actions of the projected task.
+    /// @param action_costs are the costs of the original actions. The task determines them, but a change of the cost model does not change the key,
+    /// such that the stored label costs are compared against them.
+    std::optional<ProjectionAbstraction<LiftedTag>> load(uint64_t key,
+                                                         ProjectionMapping<LiftedTag> mapping,
+                                                         const ProjectionMapping<LiftedTag>::ActionMapping& projected_to_original_action,
+                                                         const ActionCosts& action_costs) const;
+
+    /// @brief Store the projection with the given key, and return whether this succeeded.
+    bool store(uint64_t key, const ProjectionAbstraction<LiftedTag>& projection) const;
+
+private:
+    std::filesystem::path get_path(uint64_t key) const;
+
+    std::filesystem::path m_directory;
+    uint64_t m_task_hash;
+};
+
+}
+
+#endif
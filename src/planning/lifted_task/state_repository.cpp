@@ -27,6 +27,7 @@
 #include "tyr/planning/state_repository.hpp"             // for StateR...
 #include "tyr/planning/task_utils.hpp"                   // for create...
 
+#include <cassert>
 #include <tuple>           // for operat...
 #include <utility>         // for move
 #include <valla/slot.hpp>  // for Slot
@@ -36,10 +37,25 @@ namespace fp = tyr::formalism::planning;
 
 namespace tyr::planning
 {
+namespace
+{
+template<typename Tag>
+StateStorageContext<LiftedTag, Tag> create_state_storage_context(const Task<LiftedTag>& task, [[maybe_unused]] const StateStorageOptions& options)
+{
+    if constexpr (std::same_as<Tag, Dynamic>)
+        return StateStorageContext<LiftedTag, Tag>(task, options);
+    else if constexpr (std::is_constructible_v<StateStorageContext<LiftedTag, Tag>, const Task<LiftedTag>&>)
+        return StateStorageContext<LiftedTag, Tag>(task);
+    else
+        return StateStorageContext<LiftedTag, Tag>();
+}
+}
 
-StateRepository<LiftedTag>::StateRepository(std::shared_ptr<Task<LiftedTag>> task, ExecutionContextPtr execution_context) :
+StateRepository<LiftedTag>::StateRepository(std::shared_ptr<Task<LiftedTag>> task,
+                                            ExecutionContextPtr execution_context,
+                                            StateStorageOptions storage_options) :
     m_task(task),
-    m_context(),
+    m_context(create_state_storage_context<StateStoragePolicyTag>(*m_task, storage_options)),
     m_fluent_backend(m_context),
     m_derived_backend(m_context),
     m_numeric_backend(m_context),
@@ -48,9 +64,10 @@ StateRepository<LiftedTag>::StateRepository(std::shared_ptr<Task<LiftedTag>> tas
 {
 }
 
-std::shared_ptr<StateRepository<LiftedTag>> StateRepository<LiftedTag>::create(std::shared_ptr<Task<LiftedTag>> task, ExecutionContextPtr execution_context)
+std::shared_ptr<StateRepository<LiftedTag>>
+StateRepository<LiftedTag>::create(std::shared_ptr<Task<LiftedTag>> task, ExecutionContextPtr execution_context, StateStorageOptions storage_options)
 {
-    return std::make_shared<StateRepository<LiftedTag>>(std::move(task), std::move(execution_context));
+    return std::make_shared<StateRepository<LiftedTag>>(std::move(task), std::move(execution_context), storage_options);
 }
 
 StateView<LiftedTag> StateRepository<LiftedTag>::get_initial_state()
@@ -126,9 +143,40 @@ StateView<LiftedTag> StateRepository<LiftedTag>::register_state(SharedObjectPool
                                                   m_numeric_backend.insert(state->get_numeric_variables())))
                    .first);
 
+#if defined(TYR_STATE_STORAGE_DYNAMIC)
+    if (m_context.requires_migration())
+        migrate_state_storage();
+#endif
+
     return StateView<LiftedTag>(shared_from_this(), std::move(state));
 }
 
+#if defined(TYR_STATE_STORAGE_DYNAMIC)
+void StateRepository<LiftedTag>::migrate_state_storage()
+{
+    m_context.begin_migration();
+
+    auto buffer = get_unregistered_state();
+    auto migrated_states = IndexedHashSet<State<LiftedTag>>();
+
+    for (uint_t i = 0; i < m_packed_states.size(); ++i)
+    {
+        const auto& packed_state = m_packed_states[Index<State<LiftedTag>>(i)];
+
+        [[maybe_unused]] const auto [index, inserted] = migrated_states.insert(
+            Data<State<LiftedTag>>(Index<State<LiftedTag>>(i),
+                                   m_fluent_backend.migrate(packed_state.template get_atoms<f::FluentTag>(), buffer->template get_atoms<f::FluentTag>()),
+                                   m_derived_backend.migrate(packed_state.template get_atoms<f::DerivedTag>(), buffer->template get_atoms<f::DerivedTag>()),
+                                   m_numeric_backend.migrate(packed_state.get_numeric_variables(), buffer->get_numeric_variables())));
+        assert(inserted && uint_t(index) == i);
+    }
+
+    m_packed_states = std::move(migrated_states);
+
+    m_context.end_migration();
+}
+#endif
+
 size_t StateRepository<LiftedTag>::memory_usage() const noexcept
 {
     size_t bytes = 0;
@@ -73,7 +73,9 @@ void for_each_action_binding(const d::ProgramWorkspace<d::NoOrAnnotationPolicy,
 }
 }
 
-SuccessorGenerator<LiftedTag>::SuccessorGenerator(std::shared_ptr<Task<LiftedTag>> task, ExecutionContextPtr execution_context) :
+SuccessorGenerator<LiftedTag>::SuccessorGenerator(std::shared_ptr<Task<LiftedTag>> task,
+                                                  ExecutionContextPtr execution_context,
+                                                  StateStorageOptions storage_options) :
     m_task(std::move(task)),
     m_execution_context(std::move(execution_context)),
     m_workspace(m_task->get_action_program().get_program_context(),
@@ -81,15 +83,16 @@ SuccessorGenerator<LiftedTag>::SuccessorGenerator(std::shared_ptr<Task<LiftedTag
                 d::NoOrAnnotationPolicy(),
                 d::NoAndAnnotationPolicy(),
                 d::NoTerminationPolicy()),
-    m_state_repository(std::make_shared<StateRepository<LiftedTag>>(m_task, m_execution_context)),
+    m_state_repository(std::make_shared<StateRepository<LiftedTag>>(m_task, m_execution_context, storage_options)),
     m_executor()
 {
 }
 
 std::shared_ptr<SuccessorGenerator<LiftedTag>> SuccessorGenerator<LiftedTag>::create(std::shared_ptr<Task<LiftedTag>> task,
-                                                                                     ExecutionContextPtr execution_context)
+                                                                                     ExecutionContextPtr execution_context,
+                                                                                     StateStorageOptions storage_options)
 {
-    return std::make_shared<SuccessorGenerator<LiftedTag>>(std::move(task), std::move(execution_context));
+    return std::make_shared<SuccessorGenerator<LiftedTag>>(std::move(task), std::move(execution_context), storage_options);
 }
 
 Node<LiftedTag> SuccessorGenerator<LiftedTag>::get_initial_node()
@@ -111,7 +114,7 @@ void SuccessorGenerator<LiftedTag>::get_labeled_successor_nodes(const Node<Lifte
 {
     out_nodes.clear();
 
-    compute_action_facts(node);
+    compute_action_facts(node.get_state());
 
     auto grounder_context = fp::GrounderContext { m_workspace.planning_builder, *m_task->get_repository(), m_workspace.binding };
     const auto state_context = StateContext<LiftedTag>(*m_task, node.get_state().get_unpacked_state(), node.get_metric());
@@ -134,6 +137,33 @@ void SuccessorGenerator<LiftedTag>::get_labeled_successor_nodes(const Node<Lifte
                             });
 }
 
+void SuccessorGenerator<LiftedTag>::get_applicable_actions(const Node<LiftedTag>& node, std::vector<fp::GroundActionView>& out_actions)
+{
+    out_actions.clear();
+
+    compute_action_facts(node.get_state());
+
+    auto grounder_context = fp::GrounderContext { m_workspace.planning_builder, *m_task->get_repository(), m_workspace.binding };
+    const auto state_context = StateContext<LiftedTag>(*m_task, node.get_state().get_unpacked_state(), node.get_metric());
+
+    for_each_action_binding(m_workspace,
+                            m_task->get_action_program(),
+                            m_workspace.binding,
+                            [&](const auto& action, const auto&)
+                            {
+                                const auto ground_action = fp::ground(action,
+                                                                      grounder_context,
+                                                                      m_task->get_grounder_cache(),
+                                                                      m_task->get_formalism_task().get_variable_domains().action_domains.at(action.get_index()),
+                                                                      m_cartesian_workspace,
+                                                                      *m_task->get_fdr_context())
+                                                               .first;
+
+                                if (m_executor.is_applicable(ground_action, state_context))
+                                    out_actions.push_back(ground_action);
+                            });
+}
+
 Node<LiftedTag> SuccessorGenerator<LiftedTag>::get_successor_node(const Node<LiftedTag>& node, fp::GroundActionView action)
 {
     const auto& state = node.get_state();
@@ -164,7 +194,7 @@ void SuccessorGenerator<LiftedTag>::get_applicable_action_bindings(const Node<Li
 {
     out_bindings.clear();
 
-    compute_action_facts(node);
+    compute_action_facts(node.get_state());
 
     const auto state_context = StateContext<LiftedTag>(*m_task, node.get_state().get_unpacked_state(), node.get_metric());
     auto grounder_context = fp::GrounderContext { m_workspace.planning_builder, *m_task->get_repository(), m_workspace.binding };
@@ -202,7 +232,7 @@ void SuccessorGenerator<LiftedTag>::for_each_applicable_action_binding_impl(cons
                                                                             ActionBindingCallback callback,
                                                                             void* callback_data)
 {
-    compute_action_facts(node);
+    compute_action_facts(node.get_state());
 
     const auto state_context = StateContext<LiftedTag>(*m_task, node.get_state().get_unpacked_state(), node.get_metric());
     auto grounder_context = fp::GrounderContext { m_workspace.planning_builder, *m_task->get_repository(), scratch_binding.objects };
@@ -255,9 +285,8 @@ void SuccessorGenerator<LiftedTag>::print_summary(size_t verbosity) const
     fmt::print(std::cout, "{}\n", datalog::compute_aggregated_rule_worker_statistics(successor_generator_rule_worker_statistics));
 }
 
-void SuccessorGenerator<LiftedTag>::compute_action_facts(const Node<LiftedTag>& node)
+void SuccessorGenerator<LiftedTag>::compute_action_facts(StateHandle<LiftedTag> state)
 {
-    const auto state = node.get_state();
     auto merge_context = fp::MergeDatalogContext { m_workspace.datalog_builder, m_workspace.workspace_repository };
     const auto& program = m_task->get_action_program();
 
@@ -46,6 +46,12 @@
 #include "tyr/planning/programs/ground.hpp"
 #include "tyr/planning/task_utils.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <oneapi/tbb/parallel_for.h>
+#include <utility>
+#include <vector>
+
 namespace d = tyr::datalog;
 namespace f = tyr::formalism;
 namespace fp = tyr::formalism::planning;
@@ -196,7 +202,7 @@ std::optional<fp::GroundConjunctiveConditionView> ground_pruned(fp::ConjunctiveC
                                                                 const UnorderedSet<fp::GroundAtomView<f::FluentTag>>& fluent_atoms,
                                                                 const UnorderedSet<fp::GroundAtomView<f::DerivedTag>>& derived_atoms,
                                                                 fp::GrounderContext& context,
-                                                                fp::FDRContext& fdr_context)
+                                                                const fp::FDRContext& fdr_context)
 {
     auto conj_cond_ptr = context.builder.template get_builder<fp::GroundConjunctiveCondition>();
     auto& conj_cond = *conj_cond_ptr;
@@ -217,10 +223,12 @@ std::optional<fp::GroundConjunctiveConditionView> ground_pruned(fp::ConjunctiveC
             continue;
 
         const auto new_fact = fdr_context.get_fact(remapped.literal->get_atom());
+        assert(new_fact.has_value() && "Mutex groups cover all reachable fluent atoms.");
+
         if (literal.get_polarity())
-            conj_cond.positive_facts.push_back(new_fact);
+            conj_cond.positive_facts.push_back(*new_fact);
         else
-            conj_cond.negative_facts.push_back(new_fact);
+            conj_cond.negative_facts.push_back(*new_fact);
     }
 
     for (const auto literal : element.template get_literals<f::DerivedTag>())
@@ -247,7 +255,7 @@ std::optional<fp::GroundConjunctiveConditionView> ground_pruned(fp::ConjunctiveC
 std::optional<fp::GroundConjunctiveEffectView> ground_pruned(fp::ConjunctiveEffectView element,
                                                              const UnorderedSet<fp::GroundAtomView<f::FluentTag>>& fluent_atoms,
                                                              fp::GrounderContext& context,
-                                                             fp::FDRContext& fdr)
+                                                             const fp::FDRContext& fdr_context)
 {
     // Fetch and clear
     auto conj_effect_ptr = context.builder.template get_builder<fp::GroundConjunctiveEffect>();
@@ -256,11 +264,19 @@ std::optional<fp::GroundConjunctiveEffectView> ground_pruned(fp::ConjunctiveEffe
 
     for (const auto literal : element.get_literals())
     {
-        const auto new_fact = ground(literal.get_atom(), context, fdr);
+        const auto new_fact = fdr_context.get_fact(ground(literal.get_atom(), context).first);
+
+        if (!new_fact.has_value())
+        {
+            // Add effects of reachable actions are reachable, so only deletes of unreachable atoms end up here.
+            assert(!literal.get_polarity());
+            continue;  // deleting an unreachable atom is a no-op
+        }
+
         if (literal.get_polarity())
-            conj_eff.add_facts.push_back(new_fact);
+            conj_eff.add_facts.push_back(*new_fact);
         else
-            conj_eff.del_facts.push_back(new_fact);
+            conj_eff.del_facts.push_back(*new_fact);
     }
     for (const auto numeric_effect : element.get_numeric_effects())
         conj_eff.numeric_effects.push_back(ground(numeric_effect, context));
@@ -280,7 +296,7 @@ std::optional<fp::GroundConditionalEffectView> ground_pruned(fp::ConditionalEffe
                                                              const UnorderedSet<fp::GroundAtomView<f::FluentTag>>& fluent_atoms,
                                                              const UnorderedSet<fp::GroundAtomView<f::DerivedTag>>& derived_atoms,
                                                              fp::GrounderContext& context,
-                                                             fp::FDRContext& fdr_context)
+                                                             const fp::FDRContext& fdr_context)
 {
     // Fetch and clear
     auto cond_effect_ptr = context.builder.template get_builder<fp::GroundConditionalEffect>();
@@ -311,7 +327,7 @@ std::optional<fp::GroundActionView> ground_pruned(fp::ActionView element,
                                                   const analysis::ActionDomain& action_domains,
                                                   itertools::cartesian_set::Workspace<Index<f::Object>>& iter_workspace,
                                                   fp::GrounderContext& context,
-                                                  fp::FDRContext& fdr_context)
+                                                  const fp::FDRContext& fdr_context)
 {
     // Fetch and clear
     auto action_ptr = context.builder.template get_builder<fp::GroundAction>();
@@ -365,7 +381,7 @@ std::optional<fp::GroundAxiomView> ground_pruned(fp::AxiomView element,
                                                  const UnorderedSet<fp::GroundAtomView<f::FluentTag>>& fluent_atoms,
                                                  const UnorderedSet<fp::GroundAtomView<f::DerivedTag>>& derived_atoms,
                                                  fp::GrounderContext& context,
-                                                 fp::FDRContext& fdr_context)
+                                                 const fp::FDRContext& fdr_context)
 {
     // Fetch and clear
     auto axiom_ptr = context.builder.template get_builder<fp::GroundAxiom>();
@@ -391,6 +407,464 @@ std::optional<fp::GroundAxiomView> ground_pruned(fp::AxiomView element,
     canonicalize(axiom);
     return context.destination.get_or_create(axiom).first;
 }
+
+/**
+ * Merge ground FDR structures from a grounding overlay into the task repository.
+ *
+ * FDR variables are created in the task repository before grounding, so FDR facts are copied as is.
+ */
+
+std::pair<fp::GroundConjunctiveConditionView, bool> merge_p2p(fp::GroundConjunctiveConditionView element, fp::MergeContext& context)
+{
+    auto conj_cond_ptr = context.builder.get_builder<fp::GroundConjunctiveCondition>();
+    auto& conj_cond = *conj_cond_ptr;
+    conj_cond.clear();
+
+    for (const auto literal : element.get_literals<f::StaticTag>())
+        conj_cond.static_literals.push_back(merge_p2p(literal, context).first.get_index());
+    for (const auto literal : element.get_literals<f::DerivedTag>())
+        conj_cond.derived_literals.push_back(merge_p2p(literal, context).first.get_index());
+    for (const auto& fact : element.get_data().positive_facts)
+        conj_cond.positive_facts.push_back(fact);
+    for (const auto& fact : element.get_data().negative_facts)
+        conj_cond.negative_facts.push_back(fact);
+    for (const auto numeric_constraint : element.get_numeric_constraints())
+        conj_cond.numeric_constraints.push_back(merge_p2p(numeric_constraint, context));
+
+    canonicalize(conj_cond);
+    return context.destination.get_or_create(conj_cond);
+}
+
+std::pair<fp::GroundConjunctiveEffectView, bool> merge_p2p(fp::GroundConjunctiveEffectView element, fp::MergeContext& context)
+{
+    auto conj_eff_ptr = context.builder.get_builder<fp::GroundConjunctiveEffect>();
+    auto& conj_eff = *conj_eff_ptr;
+    conj_eff.clear();
+
+    for (const auto& fact : element.get_data().add_facts)
+        conj_eff.add_facts.push_back(fact);
+    for (const auto& fact : element.get_data().del_facts)
+        conj_eff.del_facts.push_back(fact);
+    for (const auto numeric_effect : element.get_numeric_effects())
+        conj_eff.numeric_effects.push_back(merge_p2p(numeric_effect, context));
+    if (element.get_auxiliary_numeric_effect().has_value())
+        conj_eff.auxiliary_numeric_effect = merge_p2p(element.get_auxiliary_numeric_effect().value(), context);
+
+    canonicalize(conj_eff);
+    return context.destination.get_or_create(conj_eff);
+}
+
+std::pair<fp::GroundConditionalEffectView, bool> merge_p2p(fp::GroundConditionalEffectView element, fp::MergeContext& context)
+{
+    auto cond_effect_ptr = context.builder.get_builder<fp::GroundConditionalEffect>();
+    auto& cond_effect = *cond_effect_ptr;
+    cond_effect.clear();
+
+    cond_effect.condition = merge_p2p(element.get_condition(), context).first.get_index();
+    cond_effect.effect = merge_p2p(element.get_effect(), context).first.get_index();
+
+    canonicalize(cond_effect);
+    return context.destination.get_or_create(cond_effect);
+}
+
+std::pair<fp::GroundActionView, bool> merge_p2p(fp::GroundActionView element, fp::MergeContext& context)
+{
+    auto action_ptr = context.builder.get_builder<fp::GroundAction>();
+    auto& action = *action_ptr;
+    action.clear();
+
+    action.binding = merge_p2p(element.get_row(), context).first.get_index();
+    action.condition = merge_p2p(element.get_condition(), context).first.get_index();
+    for (const auto cond_effect : element.get_effects())
+        action.effects.push_back(merge_p2p(cond_effect, context).first.get_index());
+
+    canonicalize(action);
+    return context.destination.get_or_create(action);
+}
+
+std::pair<fp::GroundAxiomView, bool> merge_p2p(fp::GroundAxiomView element, fp::MergeContext& context)
+{
+    auto axiom_ptr = context.builder.get_builder<fp::GroundAxiom>();
+    auto& axiom = *axiom_ptr;
+    axiom.clear();
+
+    axiom.binding = merge_p2p(element.get_row(), context).first.get_index();
+    axiom.body = merge_p2p(element.get_body(), context).first.get_index();
+    axiom.head = merge_p2p(element.get_head(), context).first.get_index();
+
+    canonicalize(axiom);
+    return context.destination.get_or_create(axiom);
+}
+
+/**
+ * Parallel grounding
+ */
+
+/// @brief A reachable binding of an action or axiom computed by the ground program.
+template<typename T>
+struct GroundingJob
+{
+    T element;
+    IndexList<f::Object> binding;
+};
+
+template<typename Sets, typename Mapping>
+auto collect_grounding_jobs(const Sets& sets, const Mapping& mapping)
+{
+    auto jobs = std::vector<GroundingJob<typename Mapping::mapped_type>> {};
+
+    for (const auto& set : sets)
+    {
+        for (const auto& binding : set.get_bindings())
+        {
+            if (const auto it = mapping.find(binding.get_relation()); it != mapping.end())
+            {
+                auto& job = jobs.emplace_back(GroundingJob<typename Mapping::mapped_type> { it->second, IndexList<f::Object> {} });
+                for (const auto object : binding.get_objects())
+                    job.binding.push_back(object.get_index());
+            }
+        }
+    }
+
+    return jobs;
+}
+
+/// @brief Workspace of a chunk of grounding jobs.
+///
+/// Each chunk grounds into its own overlay of the task repository,
+/// such that the task repository remains read-only until the sequential merge.
+struct GroundingWorkspace
+{
+    explicit GroundingWorkspace(fp::RepositoryPtr overlay_repository_, fp::Repository& repository) :
+        builder(),
+        binding(),
+        iter_workspace(),
+        fluent_assign(),
+        derived_assign(),
+        overlay_repository(std::move(overlay_repository_)),
+        destination(overlay_repository ? *overlay_repository : repository)
+    {
+    }
+
+    fp::Builder builder;
+    IndexList<f::Object> binding;
+    itertools::cartesian_set::Workspace<Index<f::Object>> iter_workspace;
+    UnorderedMap<Index<fp::FDRVariable<f::FluentTag>>, fp::FDRValue> fluent_assign;
+    UnorderedMap<Index<fp::GroundAtom<f::DerivedTag>>, bool> derived_assign;
+
+    fp::RepositoryPtr overlay_repository;  ///< nullptr if grounding directly into the task repository.
+    fp::Repository& destination;
+};
+
+/// @brief Ground the jobs in contiguous chunks in parallel and merge the results sequentially in job order.
+///
+/// The merge visits the ground elements in the same order as a sequential grounding would create them,
+/// so the resulting indices do not depend on the number of threads.
+/// Elements that fail the consistency check are merged nevertheless but not returned.
+template<typename G, typename T, typename GroundFunction>
+IndexList<G> ground_in_parallel(const std::vector<GroundingJob<T>>& jobs,
+                                ExecutionContext& execution_context,
+                                fp::RepositoryFactory& factory,
+                                fp::Repository& repository,
+                                fp::Builder& builder,
+                                GroundFunction&& ground_function)
+{
+    constexpr size_t num_chunks_per_thread = 8;
+
+    const auto num_threads = execution_context.get_num_threads();
+    const auto num_chunks = (num_threads == 1) ? size_t(1) : std::max(size_t(1), std::min(jobs.size(), num_threads * num_chunks_per_thread));
+
+    auto workspaces = std::vector<std::unique_ptr<GroundingWorkspace>> {};
+    for (size_t c = 0; c < num_chunks; ++c)
+        workspaces.push_back(std::make_unique<GroundingWorkspace>((num_chunks == 1) ? nullptr : factory.create_shared(&repository), repository));
+
+    auto results = std::vector<std::vector<std::pair<Index<G>, bool>>>(num_chunks);
+
+    const auto ground_chunk = [&](size_t c)
+    {
+        auto& workspace = *workspaces[c];
+
+        for (size_t i = c * jobs.size() / num_chunks; i < (c + 1) * jobs.size() / num_chunks; ++i)
+            if (const auto result = ground_function(jobs[i], workspace))
+                results[c].push_back(result.value());
+    };
+
+    if (num_chunks == 1)
+        ground_chunk(0);
+    else
+        execution_context.arena().execute([&] { oneapi::tbb::parallel_for(size_t(0), num_chunks, ground_chunk); });
+
+    auto elements = IndexList<G> {};
+    auto merge_context = fp::MergeContext { builder, repository };
+
+    for (size_t c = 0; c < num_chunks; ++c)
+    {
+        const auto& workspace = *workspaces[c];
+
+        for (const auto& [element, is_consistent] : results[c])
+        {
+            const auto merged_element =
+                (workspace.overlay_repository) ? merge_p2p(make_view(element, *workspace.overlay_repository), merge_context).first.get_index() : element;
+
+            if (is_consistent)
+                elements.push_back(merged_element);
+        }
+
+        workspaces[c].reset();  ///< release the overlay as soon as it is merged
+    }
+
+    return elements;
+}
+
+/**
+ * Relevance analysis
+ */
+
+struct RelevanceAnalysisResult
+{
+    boost::dynamic_bitset<> mutex_groups;
+    UnorderedSet<Index<fp::GroundAtom<f::DerivedTag>>> derived_atoms;
+};
+
+/// @brief Compute the mutex groups and derived atoms that are relevant for reaching the goal.
+///
+/// A mutex group is relevant if it occurs in the goal, in the condition of an action and conditional effect
+/// that changes a relevant mutex group, or in the body of an axiom whose head is relevant.
+/// Conditional effects with numeric effects are relevant because numeric relevance is not analyzed.
+/// The ground actions and axioms must use binary FDR variables, such that every fact has an atom.
+RelevanceAnalysisResult compute_relevance(fp::GroundConjunctiveConditionView goal,
+                                          fp::GroundActionListView actions,
+                                          fp::GroundAxiomListView axioms,
+                                          const std::vector<fp::GroundAtomViewList<f::FluentTag>>& mutex_groups)
+{
+    auto atom_to_group = UnorderedMap<Index<fp::GroundAtom<f::FluentTag>>, uint_t> {};
+    for (uint_t i = 0; i < mutex_groups.size(); ++i)
+        for (const auto atom : mutex_groups[i])
+            atom_to_group.emplace(atom.get_index(), i);
+
+    const auto get_group = [&](fp::FDRFactView<f::FluentTag> fact)
+    {
+        assert(fact.get_atom().has_value());
+        return atom_to_group.at(fact.get_atom()->get_index());
+    };
+
+    /* Index the effects by the mutex groups that they change, and the axioms by their heads. */
+
+    auto effects_by_group = std::vector<std::vector<std::pair<uint_t, fp::GroundConditionalEffectView>>>(mutex_groups.size());
+    auto axioms_by_head = UnorderedMap<Index<fp::GroundAtom<f::DerivedTag>>, std::vector<fp::GroundConjunctiveConditionView>> {};
+
+    for (uint_t i = 0; i < actions.size(); ++i)
+    {
+        for (const auto cond_effect : actions[i].get_effects())
+        {
+            for (const auto fact : cond_effect.get_effect().get_facts<f::PositiveTag>())
+                effects_by_group[get_group(fact)].emplace_back(i, cond_effect);
+            for (const auto fact : cond_effect.get_effect().get_facts<f::NegativeTag>())
+                effects_by_group[get_group(fact)].emplace_back(i, cond_effect);
+        }
+    }
+
+    for (const auto axiom : axioms)
+        axioms_by_head[axiom.get_head().get_index()].push_back(axiom.get_body());
+
+    /* Propagate relevance backwards from the goal. */
+
+    auto result = RelevanceAnalysisResult { boost::dynamic_bitset<>(mutex_groups.size()), {} };
+    auto is_relevant_action = boost::dynamic_bitset<>(actions.size());
+    auto group_queue = std::vector<uint_t> {};
+    auto derived_queue = std::vector<Index<fp::GroundAtom<f::DerivedTag>>> {};
+
+    const auto mark_condition = [&](fp::GroundConjunctiveConditionView condition)
+    {
+        const auto mark_group = [&](uint_t group)
+        {
+            if (!result.mutex_groups.test_set(group))
+                group_queue.push_back(group);
+        };
+
+        for (const auto fact : condition.get_facts<f::PositiveTag>())
+            mark_group(get_group(fact));
+        for (const auto fact : condition.get_facts<f::NegativeTag>())
+            mark_group(get_group(fact));
+        for (const auto literal : condition.get_literals<f::DerivedTag>())
+            if (result.derived_atoms.insert(literal.get_atom().get_index()).second)
+                derived_queue.push_back(literal.get_atom().get_index());
+    };
+
+    const auto mark_effect = [&](uint_t action, fp::GroundConditionalEffectView cond_effect)
+    {
+        if (!is_relevant_action.test_set(action))
+            mark_condition(actions[action].get_condition());
+
+        mark_condition(cond_effect.get_condition());
+    };
+
+    mark_condition(goal);
+
+    for (uint_t i = 0; i < actions.size(); ++i)
+        for (const auto cond_effect : actions[i].get_effects())
+            if (!cond_effect.get_effect().get_numeric_effects().empty())
+                mark_effect(i, cond_effect);
+
+    while (!group_queue.empty() || !derived_queue.empty())
+    {
+        if (!group_queue.empty())
+        {
+            const auto group = group_queue.back();
+            group_queue.pop_back();
+
+            for (const auto& [action, cond_effect] : effects_by_group[group])
+                mark_effect(action, cond_effect);
+        }
+        else
+        {
+            const auto atom = derived_queue.back();
+            derived_queue.pop_back();
+
+            if (const auto it = axioms_by_head.find(atom); it != axioms_by_head.end())
+                for (const auto body : it->second)
+                    mark_condition(body);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Merge relevant ground FDR structures from the relevance overlay into the task repository.
+ *
+ * The overlay uses binary FDR variables, so facts are translated through their atoms into the FDR variables of the task.
+ * Effects on atoms without FDR variable are irrelevant and dropped.
+ */
+
+std::optional<Data<fp::FDRFact<f::FluentTag>>> translate_fact(fp::FDRFactView<f::FluentTag> fact, const fp::FDRContext& fdr_context)
+{
+    assert(fact.get_atom().has_value());
+
+    return fdr_context.get_fact(fact.get_atom().value());
+}
+
+fp::GroundConjunctiveConditionView merge_relevant(fp::GroundConjunctiveConditionView element, const fp::FDRContext& fdr_context, fp::MergeContext& context)
+{
+    auto conj_cond_ptr = context.builder.get_builder<fp::GroundConjunctiveCondition>();
+    auto& conj_cond = *conj_cond_ptr;
+    conj_cond.clear();
+
+    for (const auto literal : element.get_literals<f::StaticTag>())
+        conj_cond.static_literals.push_back(merge_p2p(literal, context).first.get_index());
+    for (const auto literal : element.get_literals<f::DerivedTag>())
+        conj_cond.derived_literals.push_back(merge_p2p(literal, context).first.get_index());
+    for (const auto fact : element.get_facts<f::PositiveTag>())
+        conj_cond.positive_facts.push_back(translate_fact(fact, fdr_context).value());
+    for (const auto fact : element.get_facts<f::NegativeTag>())
+        conj_cond.negative_facts.push_back(translate_fact(fact, fdr_context).value());
+    for (const auto numeric_constraint : element.get_numeric_constraints())
+        conj_cond.numeric_constraints.push_back(merge_p2p(numeric_constraint, context));
+
+    canonicalize(conj_cond);
+    return context.destination.get_or_create(conj_cond).first;
+}
+
+std::optional<fp::GroundConjunctiveEffectView> merge_relevant(fp::GroundConjunctiveEffectView element, const fp::FDRContext& fdr_context, fp::MergeContext& context)
+{
+    auto conj_eff_ptr = context.builder.get_builder<fp::GroundConjunctiveEffect>();
+    auto& conj_eff = *conj_eff_ptr;
+    conj_eff.clear();
+
+    for (const auto fact : element.get_facts<f::PositiveTag>())
+        if (const auto new_fact = translate_fact(fact, fdr_context))
+            conj_eff.add_facts.push_back(*new_fact);
+    for (const auto fact : element.get_facts<f::NegativeTag>())
+        if (const auto new_fact = translate_fact(fact, fdr_context))
+            conj_eff.del_facts.push_back(*new_fact);
+    for (const auto numeric_effect : element.get_numeric_effects())
+        conj_eff.numeric_effects.push_back(merge_p2p(numeric_effect, context));
+    if (element.get_auxiliary_numeric_effect().has_value())
+        conj_eff.auxiliary_numeric_effect = merge_p2p(element.get_auxiliary_numeric_effect().value(), context);
+
+    // Prune effects that only change irrelevant atoms
+    if (conj_eff.add_facts.empty() && conj_eff.del_facts.empty() && conj_eff.numeric_effects.empty())
+        return std::nullopt;
+
+    canonicalize(conj_eff);
+    return context.destination.get_or_create(conj_eff).first;
+}
+
+std::optional<fp::GroundConditionalEffectView> merge_relevant(fp::GroundConditionalEffectView element, const fp::FDRContext& fdr_context, fp::MergeContext& context)
+{
+    const auto new_effect_or_nullopt = merge_relevant(element.get_effect(), fdr_context, context);
+    if (!new_effect_or_nullopt)
+        return std::nullopt;
+
+    const auto new_condition = merge_relevant(element.get_condition(), fdr_context, context);
+
+    auto cond_effect_ptr = context.builder.get_builder<fp::GroundConditionalEffect>();
+    auto& cond_effect = *cond_effect_ptr;
+    cond_effect.clear();
+
+    cond_effect.condition = new_condition.get_index();
+    cond_effect.effect = new_effect_or_nullopt->get_index();
+
+    canonicalize(cond_effect);
+    return context.destination.get_or_create(cond_effect).first;
+}
+
+std::optional<fp::GroundActionView> merge_relevant(fp::GroundActionView element, const fp::FDRContext& fdr_context, fp::MergeContext& context)
+{
+    auto effects = IndexList<fp::GroundConditionalEffect> {};
+    for (const auto cond_effect : element.get_effects())
+        if (const auto new_cond_effect = merge_relevant(cond_effect, fdr_context, context))
+            effects.push_back(new_cond_effect->get_index());
+
+    if (effects.empty())
+        return std::nullopt;  // irrelevant action
+
+    const auto new_condition = merge_relevant(element.get_condition(), fdr_context, context);
+
+    auto action_ptr = context.builder.get_builder<fp::GroundAction>();
+    auto& action = *action_ptr;
+    action.clear();
+
+    action.binding = merge_p2p(element.get_row(), context).first.get_index();
+    action.condition = new_condition.get_index();
+    action.effects = std::move(effects);
+
+    canonicalize(action);
+    return context.destination.get_or_create(action).first;
+}
+
+std::optional<fp::GroundAxiomView> merge_relevant(fp::GroundAxiomView element, const fp::FDRContext& fdr_context, fp::MergeContext& context)
+{
+    const auto new_body = merge_relevant(element.get_body(), fdr_context, context);
+
+    auto axiom_ptr = context.builder.get_builder<fp::GroundAxiom>();
+    auto& axiom = *axiom_ptr;
+    axiom.clear();
+
+    axiom.binding = merge_p2p(element.get_row(), context).first.get_index();
+    axiom.body = new_body.get_index();
+    axiom.head = merge_p2p(element.get_head(), context).first.get_index();
+
+    canonicalize(axiom);
+    return context.destination.get_or_create(axiom).first;
+}
+
+/// @brief Merge the relevant parts of the elements in order, dropping irrelevant and inconsistent elements.
+template<typename G>
+IndexList<G> merge_relevant(const IndexList<G>& elements, const fp::Repository& source, const fp::FDRContext& fdr_context, fp::MergeContext& context)
+{
+    auto fluent_assign = UnorderedMap<Index<fp::FDRVariable<f::FluentTag>>, fp::FDRValue> {};
+    auto derived_assign = UnorderedMap<Index<fp::GroundAtom<f::DerivedTag>>, bool> {};
+
+    auto result = IndexList<G> {};
+
+    for (const auto element : elements)
+        if (const auto merged_element = merge_relevant(make_view(element, source), fdr_context, context))
+            if (is_consistent(merged_element.value(), fluent_assign, derived_assign))  ///< mutex groups may reveal further inconsistencies
+                result.push_back(merged_element->get_index());
+
+    return result;
+}
 }
 
 GroundTaskInstantiationResult instantiate_ground_task(LiftedTask& lifted_task,  //
@@ -498,16 +972,19 @@ GroundTaskInstantiationResult instantiate_ground_task(LiftedTask& lifted_task,
     // std::cout << "Derived atoms:" << std::endl;
     // std::cout << derived_atoms << std::endl;
 
-    auto fdr_context = std::shared_ptr<fp::FDRContext> { nullptr };
+    auto mutex_groups = std::vector<fp::GroundAtomViewList<f::FluentTag>> {};
 
     if (options.disable_invariant_synthesis)
     {
-        fdr_context = std::make_shared<fp::FDRContext>(fluent_atoms, repository);
+        for (const auto atom : fluent_atoms)
+            mutex_groups.push_back(fp::GroundAtomViewList<f::FluentTag> { atom });
     }
     else
     {
-        auto invariants = fpi::synthesize_invariants(planning_domain.get_domain());
-        auto mutex_groups = fpi::compute_mutex_groups(initial_atoms, fluent_atoms, invariants);
+        auto synthesis_options = fpi::SynthesisOptions();
+        synthesis_options.max_time = options.max_invariant_synthesis_time;
+        auto invariants = fpi::synthesize_invariants(planning_domain.get_domain(), execution_context, synthesis_options);
+        mutex_groups = fpi::compute_mutex_groups(initial_atoms, fluent_atoms, invariants);
 
         // std::cout << "Invariants:" << std::endl;
         // print(std::cout, invariants);
@@ -515,10 +992,121 @@ GroundTaskInstantiationResult instantiate_ground_task(LiftedTask& lifted_task,
         // std::cout << "Mutex groups:" << std::endl;
         // print(std::cout, mutex_groups);
         // std::cout << std::endl;
+    }
+
+    /// --- Prepare grounding of actions and axioms
+
+    auto static_atoms_bitset = boost::dynamic_bitset<>();
+    for (const auto atom : task.get_atoms<f::StaticTag>())
+        set(uint_t(atom.get_index()), true, static_atoms_bitset);
+
+    const auto& fact_sets = workspace.facts.fact_sets.predicate.get_sets();
+    const auto& action_domains = lifted_task.get_formalism_task().get_variable_domains().action_domains;
+    auto& factory = *planning_domain.get_repository_factory();
+
+    const auto action_jobs = collect_grounding_jobs(fact_sets, ground_program.get_predicate_to_action_mapping());
+    const auto axiom_jobs = collect_grounding_jobs(fact_sets, ground_program.get_predicate_to_axiom_mapping());
+
+    const auto ground_actions = [&](fp::Repository& destination, const fp::FDRContext& grounding_fdr_context)
+    {
+        return ground_in_parallel<fp::GroundAction>(
+            action_jobs,
+            execution_context,
+            factory,
+            destination,
+            builder,
+            [&](const auto& job, GroundingWorkspace& ws) -> std::optional<std::pair<Index<fp::GroundAction>, bool>>
+            {
+                ws.binding.clear();
+                ws.binding.insert(ws.binding.end(), job.binding.begin(), job.binding.end());
 
-        fdr_context = std::make_shared<fp::FDRContext>(mutex_groups, repository);
+                auto grounder_context = fp::GrounderContext { ws.builder, ws.destination, ws.binding };
+
+                const auto ground_action_or_nullopt = ground_pruned(job.element,
+                                                                    fluent_atoms_set,
+                                                                    derived_atoms_set,
+                                                                    action_domains.at(job.element.get_index()),
+                                                                    ws.iter_workspace,
+                                                                    grounder_context,
+                                                                    grounding_fdr_context);
+
+                if (!ground_action_or_nullopt.has_value())
+                    return std::nullopt;
+
+                const auto& ground_action = ground_action_or_nullopt.value();
+
+                assert(is_statically_applicable(ground_action, static_atoms_bitset));
+
+                return std::make_pair(ground_action.get_index(), is_consistent(ground_action, ws.fluent_assign, ws.derived_assign));
+            });
+    };
+
+    const auto ground_axioms = [&](fp::Repository& destination, const fp::FDRContext& grounding_fdr_context)
+    {
+        return ground_in_parallel<fp::GroundAxiom>(
+            axiom_jobs,
+            execution_context,
+            factory,
+            destination,
+            builder,
+            [&](const auto& job, GroundingWorkspace& ws) -> std::optional<std::pair<Index<fp::GroundAxiom>, bool>>
+            {
+                ws.binding.clear();
+                ws.binding.insert(ws.binding.end(), job.binding.begin(), job.binding.end());
+
+                auto grounder_context = fp::GrounderContext { ws.builder, ws.destination, ws.binding };
+
+                const auto ground_axiom_or_nullopt = ground_pruned(job.element, fluent_atoms_set, derived_atoms_set, grounder_context, grounding_fdr_context);
+
+                if (!ground_axiom_or_nullopt.has_value())
+                    return std::nullopt;
+
+                const auto& ground_axiom = ground_axiom_or_nullopt.value();
+
+                assert(is_statically_applicable(ground_axiom, static_atoms_bitset));
+
+                return std::make_pair(ground_axiom.get_index(), is_consistent(ground_axiom, ws.fluent_assign, ws.derived_assign));
+            });
+    };
+
+    /// --- Relevance analysis
+
+    // The overlay grounds with binary FDR variables such that only the relevant mutex groups become FDR variables of the task.
+    auto relevance_repository = fp::RepositoryPtr { nullptr };
+    auto relevance_actions = IndexList<fp::GroundAction> {};
+    auto relevance_axioms = IndexList<fp::GroundAxiom> {};
+
+    if (options.enable_relevance_analysis)
+    {
+        relevance_repository = factory.create_shared(repository.get());
+        auto relevance_fdr_context = fp::FDRContext(fluent_atoms, relevance_repository);
+        auto relevance_merge_context = fp::MergeContext { builder, *relevance_repository };
+
+        const auto relevance_goal =
+            create_ground_fdr_conjunctive_condition(task.get_goal(), fluent_atoms_set, derived_atoms_set, relevance_fdr_context, relevance_merge_context);
+        if (!relevance_goal.has_value())
+            return GroundTaskInstantiationResult { nullptr, GroundTaskInstantiationStatus::PROVEN_UNSOLVABLE };
+
+        relevance_actions = ground_actions(*relevance_repository, relevance_fdr_context);
+        relevance_axioms = ground_axioms(*relevance_repository, relevance_fdr_context);
+
+        const auto relevance = compute_relevance(relevance_goal.value(),
+                                                 make_view(relevance_actions, *relevance_repository),
+                                                 make_view(relevance_axioms, *relevance_repository),
+                                                 mutex_groups);
+
+        std::erase_if(relevance_axioms,
+                      [&](auto axiom) { return !relevance.derived_atoms.contains(make_view(axiom, *relevance_repository).get_head().get_index()); });
+
+        auto relevant_mutex_groups = std::vector<fp::GroundAtomViewList<f::FluentTag>> {};
+        for (uint_t i = 0; i < mutex_groups.size(); ++i)
+            if (relevance.mutex_groups.test(i))
+                relevant_mutex_groups.push_back(std::move(mutex_groups[i]));
+        mutex_groups = std::move(relevant_mutex_groups);
     }
 
+    auto fdr_context = std::make_shared<fp::FDRContext>(mutex_groups, repository);
+
     for (const auto atom : task.get_atoms<f::StaticTag>())
         fdr_task.static_atoms.push_back(merge_p2p(atom, merge_context).first.get_index());
     for (const auto atom : fluent_atoms)
@@ -542,7 +1130,8 @@ GroundTaskInstantiationResult instantiate_ground_task(LiftedTask& lifted_task,
 
     /// --- Create FDR fluent facts
     for (const auto atom : task.get_atoms<f::FluentTag>())
-        fdr_task.fluent_facts.push_back(fdr_context->get_fact(merge_p2p(atom, merge_context).first.get_index()));
+        if (const auto fact = std::as_const(*fdr_context).get_fact(merge_p2p(atom, merge_context).first))
+            fdr_task.fluent_facts.push_back(*fact);  ///< facts of irrelevant variables are dropped
 
     /// --- Create FDR goal
     const auto goal_or_nullopt = create_ground_fdr_conjunctive_condition(task.get_goal(), fluent_atoms_set, derived_atoms_set, *fdr_context, merge_context);
@@ -553,96 +1142,23 @@ GroundTaskInstantiationResult instantiate_ground_task(LiftedTask& lifted_task,
 
     /// --- Create FDR actions and axioms
 
-    auto fluent_assign = UnorderedMap<Index<fp::FDRVariable<f::FluentTag>>, fp::FDRValue> {};
-    auto derived_assign = UnorderedMap<Index<fp::GroundAtom<f::DerivedTag>>, bool> {};
-    auto iter_workspace = itertools::cartesian_set::Workspace<Index<f::Object>> {};
-
-    auto static_atoms_bitset = boost::dynamic_bitset<>();
-    for (const auto atom : task.get_atoms<f::StaticTag>())
-        set(uint_t(atom.get_index()), true, static_atoms_bitset);
-
-    for (const auto& set : workspace.facts.fact_sets.predicate.get_sets())
+    if (relevance_repository)
     {
-        for (const auto& binding : set.get_bindings())
-        {
-            const auto& mapping = ground_program.get_predicate_to_action_mapping();
-
-            if (const auto it = mapping.find(binding.get_relation()); it != mapping.end())
-            {
-                const auto action = it->second;
-
-                workspace.binding.clear();
-                for (const auto object : binding.get_objects())
-                    workspace.binding.push_back(object.get_index());
-
-                auto grounder_context = fp::GrounderContext { workspace.planning_builder, *repository, workspace.binding };
-
-                const auto ground_action_or_nullopt =
-                    ground_pruned(action,
-                                  fluent_atoms_set,
-                                  derived_atoms_set,
-                                  lifted_task.get_formalism_task().get_variable_domains().action_domains.at(action.get_index()),
-                                  iter_workspace,
-                                  grounder_context,
-                                  *fdr_context);
-
-                if (!ground_action_or_nullopt.has_value())
-                    continue;
-
-                const auto& ground_action = ground_action_or_nullopt.value();
-
-                assert(is_statically_applicable(ground_action, static_atoms_bitset));
-
-                if (is_consistent(ground_action, fluent_assign, derived_assign))
-                {
-                    fdr_task.ground_actions.push_back(ground_action.get_index());
-                }
-            }
-        }
+        fdr_task.ground_actions = merge_relevant<fp::GroundAction>(relevance_actions, *relevance_repository, *fdr_context, merge_context);
+        fdr_task.ground_axioms = merge_relevant<fp::GroundAxiom>(relevance_axioms, *relevance_repository, *fdr_context, merge_context);
     }
-
-    /// --- Ground Axioms
-
-    auto ground_axioms_set = UnorderedSet<Index<fp::GroundAxiom>> {};
-
-    for (const auto& set : workspace.facts.fact_sets.predicate.get_sets())
+    else
     {
-        for (const auto& binding : set.get_bindings())
-        {
-            const auto& mapping = ground_program.get_predicate_to_axiom_mapping();
-
-            if (const auto it = mapping.find(binding.get_relation()); it != mapping.end())
-            {
-                const auto axiom = it->second;
-
-                workspace.binding.clear();
-                for (const auto object : binding.get_objects())
-                    workspace.binding.push_back(object.get_index());
-
-                auto grounder_context = fp::GrounderContext { workspace.planning_builder, *repository, workspace.binding };
-
-                const auto ground_axiom_or_nullopt = ground_pruned(axiom, fluent_atoms_set, derived_atoms_set, grounder_context, *fdr_context);
-
-                if (!ground_axiom_or_nullopt.has_value())
-                    continue;
-
-                const auto& ground_axiom = ground_axiom_or_nullopt.value();
-
-                assert(is_statically_applicable(ground_axiom, static_atoms_bitset));
-
-                if (is_consistent(ground_axiom, fluent_assign, derived_assign))
-                {
-                    fdr_task.ground_axioms.push_back(ground_axiom.get_index());
-                }
-            }
-        }
+        fdr_task.ground_actions = ground_actions(*repository, *fdr_context);
+        fdr_task.ground_axioms = ground_axioms(*repository, *fdr_context);
     }
 
     canonicalize(fdr_task);
 
     return GroundTaskInstantiationResult {
         std::make_shared<GroundTask>(
-            fp::PlanningFDRTask(repository->get_or_create(fdr_task).first, std::move(fdr_context), repository, planning_task.get_domain())),
+            fp::PlanningFDRTask(repository->get_or_create(fdr_task).first, std::move(fdr_context), repository, planning_task.get_domain()),
+            options.action_matcher),
         GroundTaskInstantiationStatus::SUCCESS
     };
 }
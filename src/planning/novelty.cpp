@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/novelty.hpp"
+
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/ground_task/state_view.hpp"
+#include "tyr/planning/lifted_task.hpp"
+#include "tyr/planning/lifted_task/state_view.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace tyr::planning
+{
+
+template<TaskKind Kind>
+NoveltyTable<Kind>::NoveltyTable(const Task<Kind>& task, uint_t arity) :
+    m_arity(arity),
+    m_variable_offsets(),
+    m_num_atoms(0),
+    m_seen_atoms(),
+    m_seen_pairs(),
+    m_atoms()
+{
+    if (m_arity < 1 || m_arity > 2)
+        throw std::invalid_argument("NoveltyTable::NoveltyTable(...): arity must be 1 or 2.");
+
+    if constexpr (std::is_same_v<Kind, GroundTag>)
+    {
+        // The value none is not an atom, such that a variable with domain size d contributes d - 1 atoms.
+        // Offsets are assigned in increasing variable index, such that atoms are ordered like their variables.
+        for (const auto variable : task.get_task().get_fluent_variables())
+        {
+            const auto i = uint_t(variable.get_index());
+            if (i >= m_variable_offsets.size())
+                m_variable_offsets.resize(i + 1, 0);
+            m_variable_offsets[i] = variable.get_domain_size() - 1;
+        }
+
+        auto num_atoms = uint_t(0);
+        for (auto& offset : m_variable_offsets)
+            num_atoms += std::exchange(offset, num_atoms);
+
+        resize(num_atoms);
+    }
+}
+
+template<TaskKind Kind>
+void NoveltyTable<Kind>::resize(uint_t num_atoms)
+{
+    if (num_atoms <= m_num_atoms)
+        return;
+
+    // Lifted tasks discover atoms during search: grow geometrically to amortize the resizing.
+    m_num_atoms = std::max(num_atoms, 2 * m_num_atoms);
+    m_seen_atoms.resize(m_num_atoms);
+    if (m_arity == 2)
+        m_seen_pairs.resize(get_pair_index(0, m_num_atoms));
+}
+
+template<TaskKind Kind>
+void NoveltyTable<Kind>::compute_atoms(const StateView<Kind>& state)
+{
+    m_atoms.clear();
+
+    for (const auto fact : state.get_fluent_facts())
+    {
+        if constexpr (std::is_same_v<Kind, GroundTag>)
+            m_atoms.push_back(m_variable_offsets[uint_t(fact.variable)] + uint_t(fact.value) - 1);
+        else
+            m_atoms.push_back(uint_t(fact.variable));
+    }
+
+    // Pair indices require lo < hi. The facts usually arrive in increasing variable index, which makes the sort cheap.
+    std::sort(m_atoms.begin(), m_atoms.end());
+
+    if (!m_atoms.empty())
+        resize(m_atoms.back() + 1);
+}
+
+template<TaskKind Kind>
+uint_t NoveltyTable<Kind>::compute_novelty_and_insert(const StateView<Kind>& state)
+{
+    compute_atoms(state);
+
+    auto novelty = m_arity + 1;
+
+    for (const auto atom : m_atoms)
+    {
+        if (!m_seen_atoms.test_set(atom))
+            novelty = 1;
+    }
+
+    if (m_arity == 2)
+    {
+        for (size_t j = 1; j < m_atoms.size(); ++j)
+        {
+            const auto offset = get_pair_index(0, m_atoms[j]);
+
+            for (size_t i = 0; i < j; ++i)
+            {
+                if (!m_seen_pairs.test_set(offset + m_atoms[i]))
+                    novelty = std::min(novelty, uint_t(2));
+            }
+        }
+    }
+
+    return novelty;
+}
+
+template<TaskKind Kind>
+void NoveltyTable<Kind>::clear()
+{
+    m_seen_atoms.reset();
+    m_seen_pairs.reset();
+}
+
+template<TaskKind Kind>
+size_t NoveltyTable<Kind>::memory_usage() const noexcept
+{
+    return (m_seen_atoms.num_blocks() + m_seen_pairs.num_blocks()) * sizeof(boost::dynamic_bitset<>::block_type)
+           + m_variable_offsets.capacity() * sizeof(uint_t) + m_atoms.capacity() * sizeof(uint_t);
+}
+
+template class NoveltyTable<LiftedTag>;
+template class NoveltyTable<GroundTag>;
+
+}
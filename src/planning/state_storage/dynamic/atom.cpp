@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "tyr/planning/state_storage/dynamic/atom.hpp"
+
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/lifted_task.hpp"
+
+#include <cassert>
+
+namespace tyr::planning
+{
+
+template<TaskKind Kind>
+AtomStorageBackend<Kind, Dynamic>::AtomStorageBackend(StateStorageContext<Kind, Dynamic>& ctx) : m_ctx(ctx)
+{
+}
+
+template<TaskKind Kind>
+typename AtomStorageBackend<Kind, Dynamic>::Packed AtomStorageBackend<Kind, Dynamic>::insert(const typename AtomStorageBackend<Kind, Dynamic>::Unpacked& unpacked)
+{
+    if (m_ctx.is_tree_compression())
+        return typename AtomStorageBackend<Kind, Dynamic>::Packed { to_slot(m_ctx.tree_compression->derived_backend.insert(unpacked)) };
+
+    return typename AtomStorageBackend<Kind, Dynamic>::Packed { to_slot(m_ctx.hash_set->derived_backend.insert(unpacked)) };
+}
+
+template<TaskKind Kind>
+void AtomStorageBackend<Kind, Dynamic>::unpack(const typename AtomStorageBackend<Kind, Dynamic>::Packed& packed, typename AtomStorageBackend<Kind, Dynamic>::Unpacked& unpacked)
+{
+    if (m_ctx.is_tree_compression())
+        m_ctx.tree_compression->derived_backend.unpack(from_slot<AtomPackedStorage<Kind, TreeCompression>>(packed.slot), unpacked);
+    else
+        m_ctx.hash_set->derived_backend.unpack(from_slot<AtomPackedStorage<Kind, HashSet>>(packed.slot), unpacked);
+}
+
+template<TaskKind Kind>
+typename AtomStorageBackend<Kind, Dynamic>::Packed AtomStorageBackend<Kind, Dynamic>::migrate(const typename AtomStorageBackend<Kind, Dynamic>::Packed& packed, typename AtomStorageBackend<Kind, Dynamic>::Unpacked& buffer)
+{
+    assert(m_ctx.hash_set && m_ctx.tree_compression);
+
+    m_ctx.hash_set->derived_backend.unpack(from_slot<AtomPackedStorage<Kind, HashSet>>(packed.slot), buffer);
+
+    return typename AtomStorageBackend<Kind, Dynamic>::Packed { to_slot(m_ctx.tree_compression->derived_backend.insert(buffer)) };
+}
+
+template class AtomStorageBackend<GroundTag, Dynamic>;
+template class AtomStorageBackend<LiftedTag, Dynamic>;
+
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "tyr/planning/state_storage/dynamic/context.hpp"
+
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/lifted_task.hpp"
+
+#include <cassert>
+
+namespace tyr::planning
+{
+namespace
+{
+template<typename Tag, TaskKind Kind>
+auto create_backends(const Task<Kind>& task)
+{
+    if constexpr (std::is_constructible_v<StateStorageContext<Kind, Tag>, const Task<Kind>&>)
+        return std::make_unique<StateStorageBackends<Kind, Tag>>(task);
+    else
+        return std::make_unique<StateStorageBackends<Kind, Tag>>();
+}
+}
+
+template<TaskKind Kind>
+StateStorageContext<Kind, Dynamic>::StateStorageContext(const Task<Kind>& task, StateStorageOptions options) :
+    task(task),
+    options(options),
+    hash_set(options.kind != StateStorageKind::TREE_COMPRESSION ? create_backends<HashSet>(task) : nullptr),
+    tree_compression(options.kind == StateStorageKind::TREE_COMPRESSION ? create_backends<TreeCompression>(task) : nullptr)
+{
+}
+
+template<TaskKind Kind>
+bool StateStorageContext<Kind, Dynamic>::requires_migration() const noexcept
+{
+    return options.kind == StateStorageKind::AUTOMATIC && !is_tree_compression() && hash_set->context.memory_usage() >= options.migration_threshold;
+}
+
+template<TaskKind Kind>
+void StateStorageContext<Kind, Dynamic>::begin_migration()
+{
+    assert(hash_set && !tree_compression);
+
+    tree_compression = create_backends<TreeCompression>(task);
+}
+
+template<TaskKind Kind>
+void StateStorageContext<Kind, Dynamic>::end_migration()
+{
+    assert(hash_set && tree_compression);
+
+    hash_set.reset();
+}
+
+template<TaskKind Kind>
+size_t StateStorageContext<Kind, Dynamic>::memory_usage() const noexcept
+{
+    size_t bytes = 0;
+    bytes += hash_set ? hash_set->context.memory_usage() : 0;
+    bytes += tree_compression ? tree_compression->context.memory_usage() : 0;
+    return bytes;
+}
+
+template struct StateStorageContext<GroundTag, Dynamic>;
+template struct StateStorageContext<LiftedTag, Dynamic>;
+
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "tyr/planning/state_storage/dynamic/fact.hpp"
+
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/lifted_task.hpp"
+
+#include <cassert>
+
+namespace tyr::planning
+{
+
+template<TaskKind Kind>
+FactStorageBackend<Kind, Dynamic>::FactStorageBackend(StateStorageContext<Kind, Dynamic>& ctx) : m_ctx(ctx)
+{
+}
+
+template<TaskKind Kind>
+typename FactStorageBackend<Kind, Dynamic>::Packed FactStorageBackend<Kind, Dynamic>::insert(const typename FactStorageBackend<Kind, Dynamic>::Unpacked& unpacked)
+{
+    if (m_ctx.is_tree_compression())
+        return typename FactStorageBackend<Kind, Dynamic>::Packed { to_slot(m_ctx.tree_compression->fluent_backend.insert(unpacked)) };
+
+    return typename FactStorageBackend<Kind, Dynamic>::Packed { to_slot(m_ctx.hash_set->fluent_backend.insert(unpacked)) };
+}
+
+template<TaskKind Kind>
+void FactStorageBackend<Kind, Dynamic>::unpack(const typename FactStorageBackend<Kind, Dynamic>::Packed& packed, typename FactStorageBackend<Kind, Dynamic>::Unpacked& unpacked)
+{
+    if (m_ctx.is_tree_compression())
+        m_ctx.tree_compression->fluent_backend.unpack(from_slot<FactPackedStorage<Kind, TreeCompression>>(packed.slot), unpacked);
+    else
+        m_ctx.hash_set->fluent_backend.unpack(from_slot<FactPackedStorage<Kind, HashSet>>(packed.slot), unpacked);
+}
+
+template<TaskKind Kind>
+typename FactStorageBackend<Kind, Dynamic>::Packed FactStorageBackend<Kind, Dynamic>::migrate(const typename FactStorageBackend<Kind, Dynamic>::Packed& packed, typename FactStorageBackend<Kind, Dynamic>::Unpacked& buffer)
+{
+    assert(m_ctx.hash_set && m_ctx.tree_compression);
+
+    m_ctx.hash_set->fluent_backend.unpack(from_slot<FactPackedStorage<Kind, HashSet>>(packed.slot), buffer);
+
+    return typename FactStorageBackend<Kind, Dynamic>::Packed { to_slot(m_ctx.tree_compression->fluent_backend.insert(buffer)) };
+}
+
+template class FactStorageBackend<GroundTag, Dynamic>;
+template class FactStorageBackend<LiftedTag, Dynamic>;
+
+}
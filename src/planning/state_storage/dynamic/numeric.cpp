@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "tyr/planning/state_storage/dynamic/numeric.hpp"
+
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/lifted_task.hpp"
+
+#include <cassert>
+
+namespace tyr::planning
+{
+
+template<TaskKind Kind>
+NumericStorageBackend<Kind, Dynamic>::NumericStorageBackend(StateStorageContext<Kind, Dynamic>& ctx) : m_ctx(ctx)
+{
+}
+
+template<TaskKind Kind>
+typename NumericStorageBackend<Kind, Dynamic>::Packed NumericStorageBackend<Kind, Dynamic>::insert(const typename NumericStorageBackend<Kind, Dynamic>::Unpacked& unpacked)
+{
+    if (m_ctx.is_tree_compression())
+        return typename NumericStorageBackend<Kind, Dynamic>::Packed { to_slot(m_ctx.tree_compression->numeric_backend.insert(unpacked)) };
+
+    return typename NumericStorageBackend<Kind, Dynamic>::Packed { to_slot(m_ctx.hash_set->numeric_backend.insert(unpacked)) };
+}
+
+template<TaskKind Kind>
+void NumericStorageBackend<Kind, Dynamic>::unpack(const typename NumericStorageBackend<Kind, Dynamic>::Packed& packed, typename NumericStorageBackend<Kind, Dynamic>::Unpacked& unpacked)
+{
+    if (m_ctx.is_tree_compression())
+        m_ctx.tree_compression->numeric_backend.unpack(from_slot<NumericPackedStorage<Kind, TreeCompression>>(packed.slot), unpacked);
+    else
+        m_ctx.hash_set->numeric_backend.unpack(from_slot<NumericPackedStorage<Kind, HashSet>>(packed.slot), unpacked);
+}
+
+template<TaskKind Kind>
+typename NumericStorageBackend<Kind, Dynamic>::Packed NumericStorageBackend<Kind, Dynamic>::migrate(const typename NumericStorageBackend<Kind, Dynamic>::Packed& packed, typename NumericStorageBackend<Kind, Dynamic>::Unpacked& buffer)
+{
+    assert(m_ctx.hash_set && m_ctx.tree_compression);
+
+    m_ctx.hash_set->numeric_backend.unpack(from_slot<NumericPackedStorage<Kind, HashSet>>(packed.slot), buffer);
+
+    return typename NumericStorageBackend<Kind, Dynamic>::Packed { to_slot(m_ctx.tree_compression->numeric_backend.insert(buffer)) };
+}
+
+template class NumericStorageBackend<GroundTag, Dynamic>;
+template class NumericStorageBackend<LiftedTag, Dynamic>;
+
+}
@@ -20,6 +20,9 @@
 
 #include <boost/json.hpp>
 
+#include <algorithm>
+#include <chrono>
+
 #include <gtest/gtest.h>
 
 namespace json = boost::json;
@@ -156,4 +159,65 @@ TEST(TyrTests, TyrFormalismPlanningInvariantsSynthesis)
     }
 }
 
+TEST(TyrTests, TyrFormalismPlanningInvariantsParallelSynthesis)
+{
+    const auto suite = tyr::common::load_json_file(absolute("tests/unit/formalism/planning/invariants/synthesis.json"));
+    const auto& suite_object = as_object(suite, "suite");
+    const auto* cases_value = suite_object.if_contains("cases");
+    ASSERT_TRUE(cases_value);
+
+    auto execution_context = ExecutionContext(4);
+
+    for (const auto& case_value : as_array(*cases_value, "suite.cases"))
+    {
+        const auto& case_object = as_object(case_value, "case");
+        const auto name = as_string(case_object, "name", "case");
+
+        SCOPED_TRACE(name);
+
+        auto lifted_task = compute_lifted_task(absolute(as_string(case_object, "domain_file", "case")), absolute(as_string(case_object, "task_file", "case")));
+        auto& repository = *lifted_task.get_repository();
+
+        auto actual = fpi::synthesize_invariants(lifted_task.get_task().get_domain(), execution_context);
+        auto expected = parse_invariants(repository, case_object);
+
+        expect_invariant_sets_equal(actual, expected);
+    }
+}
+
+TEST(TyrTests, TyrFormalismPlanningInvariantsSynthesisTimeLimit)
+{
+    const auto suite = tyr::common::load_json_file(absolute("tests/unit/formalism/planning/invariants/synthesis.json"));
+    const auto& suite_object = as_object(suite, "suite");
+    const auto* cases_value = suite_object.if_contains("cases");
+    ASSERT_TRUE(cases_value);
+
+    auto execution_context = ExecutionContext(1);
+
+    for (const auto& case_value : as_array(*cases_value, "suite.cases"))
+    {
+        const auto& case_object = as_object(case_value, "case");
+        const auto name = as_string(case_object, "name", "case");
+
+        SCOPED_TRACE(name);
+
+        auto lifted_task = compute_lifted_task(absolute(as_string(case_object, "domain_file", "case")), absolute(as_string(case_object, "task_file", "case")));
+        const auto domain = lifted_task.get_task().get_domain();
+
+        const auto all = fpi::synthesize_invariants(domain, execution_context);
+
+        // A time limit stops the synthesis early, and every returned invariant is one that the unlimited synthesis proves as well.
+        for (const auto max_time : { std::chrono::steady_clock::duration::zero(), std::chrono::steady_clock::duration(std::chrono::microseconds(1)) })
+        {
+            auto options = fpi::SynthesisOptions();
+            options.max_time = max_time;
+
+            const auto limited = fpi::synthesize_invariants(domain, execution_context, options);
+            EXPECT_LE(limited.size(), all.size());
+            for (const auto& invariant : limited)
+                EXPECT_TRUE(std::find(all.begin(), all.end(), invariant) != all.end());
+        }
+    }
+}
+
 }
@@ -17,9 +17,15 @@
 
 #include <gtest/gtest.h>
 #include <tyr/formalism/formalism.hpp>
+#include <tyr/planning/applicability.hpp>
 #include <tyr/planning/planning.hpp>
+#include <oneapi/tbb/global_control.h>
 
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace p = tyr::planning;
 namespace f = tyr::formalism;
@@ -42,6 +48,91 @@ p::SuccessorGenerator<p::GroundTag> create_successor_generator(std::shared_ptr<p
 
 fs::path absolute(const std::string& subdir) { return fs::path(std::string(ROOT_DIR)) / "data" / "tests" / subdir; }
 
+/// @brief Replay the plan from the initial state by applying its actions, and expect that each action is applicable and the last state is a goal.
+void expect_valid_plan(const p::Task<p::GroundTag>& task, p::SuccessorGenerator<p::GroundTag>& successor_generator, const p::Plan<p::GroundTag>& plan)
+{
+    auto node = successor_generator.get_initial_node();
+    for (const auto& step : plan.get_labeled_succ_nodes())
+    {
+        const auto successors = successor_generator.get_labeled_successor_nodes(node);
+        const auto it = std::ranges::find_if(successors, [&](const auto& successor) { return successor.label.get_index() == step.label.get_index(); });
+        ASSERT_TRUE(it != successors.end()) << "the plan applies an inapplicable action";
+        node = it->node;
+    }
+
+    EXPECT_TRUE(p::TaskGoalStrategy<p::GroundTag>(task).is_dynamic_goal_satisfied(node.get_state()));
+}
+
+/// @brief Get the name and the object names of the ground action, which identify it across tasks of the same problem.
+std::vector<std::string> get_signature(fp::GroundActionView action)
+{
+    auto signature = std::vector<std::string> { std::string(action.get_action().get_name()) };
+    for (const auto object : action.get_row().get_objects())
+        signature.push_back(std::string(object.get_name()));
+    return signature;
+}
+
+/// @brief Replay a plan of another ground task of the same problem, such as a pruned one, by matching the signatures of its actions.
+void expect_valid_plan_in_other_task(const p::Task<p::GroundTag>& task,
+                                     p::SuccessorGenerator<p::GroundTag>& successor_generator,
+                                     const p::Plan<p::GroundTag>& plan)
+{
+    auto node = successor_generator.get_initial_node();
+    for (const auto& step : plan.get_labeled_succ_nodes())
+    {
+        const auto signature = get_signature(step.label);
+        const auto successors = successor_generator.get_labeled_successor_nodes(node);
+        const auto it = std::ranges::find_if(successors, [&](const auto& successor) { return get_signature(successor.label) == signature; });
+        ASSERT_TRUE(it != successors.end()) << "the plan applies an inapplicable action";
+        node = it->node;
+    }
+
+    EXPECT_TRUE(p::TaskGoalStrategy<p::GroundTag>(task).is_dynamic_goal_satisfied(node.get_state()));
+}
+
+/// @brief Find a successor of the node by the name of its action that reaches a different state.
+p::Node<p::GroundTag> get_successor(p::SuccessorGenerator<p::GroundTag>& successor_generator, const p::Node<p::GroundTag>& node, const std::string& action_name)
+{
+    for (const auto& successor : successor_generator.get_labeled_successor_nodes(node))
+        if (std::string(successor.label.get_action().get_name()) == action_name && successor.node.get_state().get_index() != node.get_state().get_index())
+            return successor.node;
+
+    throw std::runtime_error("get_successor: no successor by " + action_name);
+}
+
+/// @brief Expect that the derived atoms of the state are those of a naive fixpoint that applies all axioms of each stratum until nothing changes.
+void expect_naive_axiom_fixpoint(const p::Task<p::GroundTag>& task, const p::StateView<p::GroundTag>& state)
+{
+    auto unpacked_state = p::UnpackedState<p::GroundTag>();
+    unpacked_state.assign_unextended_part(state.get_unpacked_state());
+    unpacked_state.resize_derived_atoms(task.get_num_atoms<f::DerivedTag>());
+
+    const auto state_context = p::StateContext<p::GroundTag> { task, unpacked_state, float_t(0) };
+
+    for (const auto& stratum : task.get_axiom_strata().data)
+    {
+        for (auto changed = true; changed;)
+        {
+            changed = false;
+            for (const auto axiom : make_view(stratum, *task.get_repository()))
+            {
+                const auto head = axiom.get_head().get_index();
+                if (!unpacked_state.test(head) && p::is_applicable(axiom, state_context))
+                {
+                    unpacked_state.set(head);
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    for (uint_t i = 0; i < task.get_num_atoms<f::DerivedTag>(); ++i)
+    {
+        const auto atom = Index<fp::GroundAtom<f::DerivedTag>>(i);
+        EXPECT_EQ(unpacked_state.test(atom), state.test(atom)) << "derived atom " << i;
+    }
+}
+
 struct GroundTaskCase
 {
     std::string name;
@@ -117,4 +208,400 @@ INSTANTIATE_TEST_SUITE_P(TyrPlanningGroundTask,
                                            GroundTaskCase { "Woodworking", "classical/woodworking", 52, 0, 198, 0, 8 },
                                            GroundTaskCase { "Zenotravel", "numeric/zenotravel", 15, 0, 37, 0, 7 }),
                          test_name);
+
+TEST(TyrPlanningGroundTask, RecursiveAxiomStrataMatchNaiveFixpoint)
+{
+    // Reachability is the transitive closure of the edges, and the other domains have axioms as well.
+    for (const auto subdir : { "classical/reachability", "classical/miconic-fulladl", "classical/philosophers", "classical/psr-middle" })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto ground_task = compute_ground_task(absolute(std::string(subdir) + "/domain.pddl"), absolute(std::string(subdir) + "/test-1.pddl"));
+        const auto& strata = ground_task->get_axiom_strata();
+        ASSERT_EQ(strata.is_recursive.size(), strata.data.size());
+        ASSERT_EQ(ground_task->get_axiom_match_tree_strata().size(), strata.data.size());
+        for (size_t s = 0; s < strata.data.size(); ++s)
+            EXPECT_EQ(ground_task->get_axiom_match_tree_strata()[s] == nullptr, bool(strata.is_recursive[s]));
+        if (std::string(subdir) == "classical/reachability")
+            EXPECT_TRUE(std::ranges::any_of(strata.is_recursive, [](bool is_recursive) { return is_recursive; }));
+
+        auto successor_generator = create_successor_generator(ground_task);
+        auto queue = std::vector<p::Node<p::GroundTag>> { successor_generator.get_initial_node() };
+        for (size_t i = 0; i < queue.size() && queue.size() < 200; ++i)
+        {
+            expect_naive_axiom_fixpoint(*ground_task, queue[i].get_state());
+
+            for (const auto& successor : successor_generator.get_labeled_successor_nodes(queue[i]))
+                if (uint_t(successor.node.get_state().get_index()) >= queue.size())
+                    queue.push_back(successor.node);
+        }
+    }
+}
+
+TEST(TyrPlanningGroundTask, RelevanceAnalysisPreservesOptimalPlanCost)
+{
+    struct RelevanceCase
+    {
+        std::string subdir;
+        std::string problem;
+        bool has_irrelevant_parts;
+    };
+
+    // Only p0 occurs in the goal of logistics test-2, so the actions and the variable of p1 are irrelevant.
+    for (const auto& [subdir, problem, has_irrelevant_parts] : { RelevanceCase { "classical/logistics", "test-2.pddl", true },
+                                                                 RelevanceCase { "classical/gripper", "test-1.pddl", false },
+                                                                 RelevanceCase { "classical/miconic-fulladl", "test-1.pddl", false },
+                                                                 RelevanceCase { "classical/psr-middle", "test-1.pddl", false },
+                                                                 RelevanceCase { "numeric/refuel-adl", "test-1.pddl", false },
+                                                                 RelevanceCase { "numeric/tpp", "test-1.pddl", false } })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto execution_context = ExecutionContext::create(1);
+        auto relevance_options = p::GroundTaskInstantiationOptions();
+        relevance_options.enable_relevance_analysis = true;
+
+        const auto domain_filepath = absolute(subdir + "/domain.pddl");
+        const auto problem_filepath = absolute(subdir + "/" + problem);
+        auto full_task = p::LiftedTask(fp::Parser(domain_filepath).parse_task(problem_filepath)).instantiate_ground_task(*execution_context).task;
+        auto pruned_task =
+            p::LiftedTask(fp::Parser(domain_filepath).parse_task(problem_filepath)).instantiate_ground_task(*execution_context, relevance_options).task;
+
+        EXPECT_LE(pruned_task->get_num_actions(), full_task->get_num_actions());
+        EXPECT_LE(pruned_task->get_num_axioms(), full_task->get_num_axioms());
+        EXPECT_LE(pruned_task->get_task().get_fluent_variables().size(), full_task->get_task().get_fluent_variables().size());
+        if (has_irrelevant_parts)
+        {
+            EXPECT_LT(pruned_task->get_num_actions(), full_task->get_num_actions());
+            EXPECT_LT(pruned_task->get_task().get_fluent_variables().size(), full_task->get_task().get_fluent_variables().size());
+        }
+
+        auto full_generator = p::SuccessorGenerator<p::GroundTag>(full_task, execution_context);
+        auto pruned_generator = p::SuccessorGenerator<p::GroundTag>(pruned_task, execution_context);
+        auto heuristic = p::BlindHeuristic<p::GroundTag>::create();
+        const auto full_result = p::astar_eager::find_solution(*full_task, full_generator, *heuristic);
+        const auto pruned_result = p::astar_eager::find_solution(*pruned_task, pruned_generator, *heuristic);
+
+        ASSERT_EQ(full_result.status, pruned_result.status);
+        if (full_result.plan.has_value())
+        {
+            EXPECT_TRUE(f::apply(f::OpEq {}, full_result.plan->get_cost(), pruned_result.plan->get_cost()));
+            expect_valid_plan_in_other_task(*full_task, full_generator, *pruned_result.plan);
+        }
+    }
+}
+
+TEST(TyrPlanningGroundTask, InvariantSynthesisTimeLimitPreservesOptimalPlanCost)
+{
+    for (const auto subdir : { "classical/gripper", "classical/miconic-fulladl", "numeric/refuel-adl" })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto execution_context = ExecutionContext::create(1);
+        auto time_limit_options = p::GroundTaskInstantiationOptions();
+        time_limit_options.max_invariant_synthesis_time = std::chrono::steady_clock::duration::zero();
+
+        const auto domain_filepath = absolute(std::string(subdir) + "/domain.pddl");
+        const auto problem_filepath = absolute(std::string(subdir) + "/test-1.pddl");
+        auto full_result = p::LiftedTask(fp::Parser(domain_filepath).parse_task(problem_filepath)).instantiate_ground_task(*execution_context);
+        auto time_limit_result =
+            p::LiftedTask(fp::Parser(domain_filepath).parse_task(problem_filepath)).instantiate_ground_task(*execution_context, time_limit_options);
+
+        // Without invariants, every fluent atom falls back to its own binary variable.
+        ASSERT_EQ(time_limit_result.status, p::GroundTaskInstantiationStatus::SUCCESS);
+        EXPECT_GE(time_limit_result.task->get_task().get_fluent_variables().size(), full_result.task->get_task().get_fluent_variables().size());
+
+        auto full_generator = p::SuccessorGenerator<p::GroundTag>(full_result.task, execution_context);
+        auto time_limit_generator = p::SuccessorGenerator<p::GroundTag>(time_limit_result.task, execution_context);
+        auto heuristic = p::BlindHeuristic<p::GroundTag>::create();
+        const auto full_search_result = p::astar_eager::find_solution(*full_result.task, full_generator, *heuristic);
+        const auto time_limit_search_result = p::astar_eager::find_solution(*time_limit_result.task, time_limit_generator, *heuristic);
+
+        ASSERT_EQ(full_search_result.status, time_limit_search_result.status);
+        if (full_search_result.plan.has_value())
+            EXPECT_TRUE(f::apply(f::OpEq {}, full_search_result.plan->get_cost(), time_limit_search_result.plan->get_cost()));
+    }
+}
+
+TEST(TyrPlanningGroundTask, WidthBasedSearchSolvesTasks)
+{
+    for (const auto subdir : { "classical/blocks_3", "classical/gripper", "classical/logistics", "classical/miconic", "classical/visitall" })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto ground_task = compute_ground_task(absolute(std::string(subdir) + "/domain.pddl"), absolute(std::string(subdir) + "/test-1.pddl"));
+        auto successor_generator = create_successor_generator(ground_task);
+        auto heuristic = p::GoalCountHeuristic<p::GroundTag>::create(ground_task);
+
+        const auto bfws_result = p::bfws::find_solution(*ground_task, successor_generator, *heuristic);
+        ASSERT_EQ(bfws_result.status, p::SearchStatus::SOLVED);
+        ASSERT_TRUE(bfws_result.plan.has_value());
+        expect_valid_plan(*ground_task, successor_generator, *bfws_result.plan);
+    }
+
+    // IW(k) is incomplete, but single goal atoms in gripper and logistics have width at most 2.
+    for (const auto subdir : { "classical/gripper", "classical/logistics" })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto ground_task = compute_ground_task(absolute(std::string(subdir) + "/domain.pddl"), absolute(std::string(subdir) + "/test-1.pddl"));
+        auto successor_generator = create_successor_generator(ground_task);
+
+        auto iw_options = p::iw::Options<p::GroundTag>();
+        iw_options.arity = 2;
+        const auto iw_result = p::iw::find_solution(*ground_task, successor_generator, iw_options);
+        ASSERT_EQ(iw_result.status, p::SearchStatus::SOLVED);
+        ASSERT_TRUE(iw_result.plan.has_value());
+        expect_valid_plan(*ground_task, successor_generator, *iw_result.plan);
+    }
+}
+
+TEST(TyrPlanningGroundTask, LazyGbfsGeneratesAtMostEagerStates)
+{
+    for (const auto subdir : { "classical/blocks_3", "classical/gripper", "classical/logistics", "classical/miconic", "classical/visitall" })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto ground_task = compute_ground_task(absolute(std::string(subdir) + "/domain.pddl"), absolute(std::string(subdir) + "/test-1.pddl"));
+        auto heuristic = p::GoalCountHeuristic<p::GroundTag>::create(ground_task);
+
+        auto eager_generator = create_successor_generator(ground_task);
+        auto eager_event_handler = p::astar_eager::DefaultEventHandler<p::GroundTag>::create(0);
+        auto eager_options = p::astar_eager::Options<p::GroundTag>();
+        eager_options.event_handler = eager_event_handler;
+        const auto eager_result = p::astar_eager::find_solution(*ground_task, eager_generator, *heuristic, eager_options);
+        ASSERT_EQ(eager_result.status, p::SearchStatus::SOLVED);
+
+        auto lazy_generator = create_successor_generator(ground_task);
+        auto lazy_event_handler = p::gbfs_lazy::DefaultEventHandler<p::GroundTag>::create(0);
+        auto lazy_options = p::gbfs_lazy::Options<p::GroundTag>();
+        lazy_options.event_handler = lazy_event_handler;
+        const auto lazy_result = p::gbfs_lazy::find_solution(*ground_task, lazy_generator, *heuristic, lazy_options);
+        ASSERT_EQ(lazy_result.status, p::SearchStatus::SOLVED);
+        ASSERT_TRUE(lazy_result.plan.has_value());
+        expect_valid_plan(*ground_task, lazy_generator, *lazy_result.plan);
+
+        // Deferred successors are only materialized when popped, hence lazy search generates no more states than eager search.
+        EXPECT_LE(lazy_event_handler->get_statistics().get_num_generated(), eager_event_handler->get_statistics().get_num_generated());
+    }
+}
+
+TEST(TyrPlanningGroundTask, GoalCountIncrementalEvaluationMatchesEvaluation)
+{
+    for (const auto subdir : { "classical/blocks_3", "classical/gripper", "classical/miconic", "classical/visitall" })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto ground_task = compute_ground_task(absolute(std::string(subdir) + "/domain.pddl"), absolute(std::string(subdir) + "/test-1.pddl"));
+        auto successor_generator = create_successor_generator(ground_task);
+        auto heuristic = p::GoalCountHeuristic<p::GroundTag>::create(ground_task);
+        ASSERT_TRUE(heuristic->has_incremental_evaluation());
+
+        auto nodes = std::vector<p::Node<p::GroundTag>> { successor_generator.get_initial_node() };
+        for (size_t i = 0; i < nodes.size() && i < 50; ++i)
+        {
+            const auto state = nodes[i].get_state();
+            const auto value = heuristic->evaluate(state);
+
+            for (const auto& successor : successor_generator.get_labeled_successor_nodes(nodes[i]))
+            {
+                EXPECT_EQ(heuristic->evaluate_successor(state, value, successor.label, successor.node.get_state()), heuristic->evaluate(successor.node.get_state()));
+                nodes.push_back(successor.node);
+            }
+        }
+    }
+}
+
+TEST(TyrPlanningGroundTask, NoveltyTableComputesNovelty)
+{
+    auto ground_task = compute_ground_task(absolute("classical/gripper/domain.pddl"), absolute("classical/gripper/test-1.pddl"));
+    auto successor_generator = create_successor_generator(ground_task);
+
+    // s1 moves the robot, s2 picks a ball, and s3 moves the robot with the ball, such that all atoms of s3 were seen in s1 or s2,
+    // but not the pair of the robot position and the carried ball.
+    const auto s0 = successor_generator.get_initial_node();
+    const auto s1 = get_successor(successor_generator, s0, "move");
+    const auto s2 = get_successor(successor_generator, s0, "pick");
+    const auto s3 = get_successor(successor_generator, s2, "move");
+
+    auto width_1 = p::NoveltyTable<p::GroundTag>(*ground_task, 1);
+    EXPECT_EQ(width_1.get_arity(), uint_t(1));
+    EXPECT_EQ(width_1.compute_novelty_and_insert(s0.get_state()), uint_t(1));
+    EXPECT_EQ(width_1.compute_novelty_and_insert(s0.get_state()), uint_t(2));
+    EXPECT_EQ(width_1.compute_novelty_and_insert(s1.get_state()), uint_t(1));
+    EXPECT_EQ(width_1.compute_novelty_and_insert(s2.get_state()), uint_t(1));
+    EXPECT_EQ(width_1.compute_novelty_and_insert(s3.get_state()), uint_t(2));
+
+    auto width_2 = p::NoveltyTable<p::GroundTag>(*ground_task, 2);
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s0.get_state()), uint_t(1));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s0.get_state()), uint_t(3));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s1.get_state()), uint_t(1));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s2.get_state()), uint_t(1));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s3.get_state()), uint_t(2));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s3.get_state()), uint_t(3));
+
+    // After clearing, no tuple is seen.
+    width_2.clear();
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s3.get_state()), uint_t(1));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s0.get_state()), uint_t(1));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s0.get_state()), uint_t(3));
+}
+
+TEST(TyrPlanningGroundTask, ProjectionMappingRanksMutexConsistentAbstractStates)
+{
+    auto ground_task = compute_ground_task(absolute("classical/gripper/domain.pddl"), absolute("classical/gripper/test-1.pddl"));
+    auto successor_generator = create_successor_generator(ground_task);
+    const auto initial_state = successor_generator.get_initial_node().get_state();
+
+    for (const auto variable : ground_task->get_task().get_fluent_variables())
+    {
+        auto facts = fp::FDRFactViewList<f::FluentTag> {};
+        for (const auto atom : variable.get_atoms())
+            facts.push_back(ground_task->get_fdr_context()->get_fact_view(atom));
+
+        const auto mapping = p::ProjectionMapping<p::GroundTag>(p::Pattern(facts));
+
+        // The facts of a variable are mutex: there is one abstract state per value instead of one per subset of the facts.
+        EXPECT_EQ(mapping.num_abstract_states(), variable.get_domain_size());
+
+        const auto abstract_state = mapping.map_state(initial_state);
+        ASSERT_LT(abstract_state, mapping.num_abstract_states());
+        mapping.for_each_fact(abstract_state, [&](uint_t i) { EXPECT_EQ(initial_state.get(facts[i].get_data().variable), facts[i].get_value()); });
+    }
+}
+
+TEST(TyrPlanningGroundTask, ParallelGroundingPreservesActionIndices)
+{
+    const auto domain_filepath = absolute("classical/pushworld/domain.pddl");
+    const auto problem_filepath = absolute("classical/pushworld/test-1.pddl");
+    // At least two workers, such that the grounding runs in parallel even on a single core.
+    // The arena takes its workers from the global pool, whose default size is the number of cores, so the pool is enlarged as well.
+    const auto num_threads = std::max<size_t>(2, std::min<size_t>(4, oneapi::tbb::info::default_concurrency()));
+    const auto parallelism = oneapi::tbb::global_control(oneapi::tbb::global_control::max_allowed_parallelism, num_threads);
+
+    auto sequential_context = ExecutionContext(1);
+    auto parallel_context = ExecutionContext(num_threads);
+    auto sequential_task = p::LiftedTask(fp::Parser(domain_filepath).parse_task(problem_filepath)).instantiate_ground_task(sequential_context).task;
+    auto parallel_task = p::LiftedTask(fp::Parser(domain_filepath).parse_task(problem_filepath)).instantiate_ground_task(parallel_context).task;
+
+    const auto sequential_actions = sequential_task->get_task().get_ground_actions();
+    const auto parallel_actions = parallel_task->get_task().get_ground_actions();
+
+    ASSERT_EQ(sequential_actions.size(), parallel_actions.size());
+    for (size_t i = 0; i < sequential_actions.size(); ++i)
+    {
+        EXPECT_EQ(sequential_actions[i].get_index(), parallel_actions[i].get_index());
+        EXPECT_EQ(sequential_actions[i].get_action().get_index(), parallel_actions[i].get_action().get_index());
+        EXPECT_EQ(sequential_actions[i].get_effects().size(), parallel_actions[i].get_effects().size());
+    }
+}
+
+TEST(TyrPlanningGroundTask, BitsetMatcherGeneratesSameApplicableActions)
+{
+    for (const auto subdir : { "classical/airport", "classical/gripper", "classical/miconic-fulladl", "classical/psr-middle", "numeric/tpp" })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto execution_context = ExecutionContext::create(1);
+        auto match_tree_options = p::GroundTaskInstantiationOptions();
+        match_tree_options.action_matcher = p::ActionMatcherKind::MATCH_TREE;
+        auto bitset_options = p::GroundTaskInstantiationOptions();
+        bitset_options.action_matcher = p::ActionMatcherKind::BITSET;
+
+        const auto domain_filepath = absolute(std::string(subdir) + "/domain.pddl");
+        const auto problem_filepath = absolute(std::string(subdir) + "/test-1.pddl");
+        auto match_tree_task =
+            p::LiftedTask(fp::Parser(domain_filepath).parse_task(problem_filepath)).instantiate_ground_task(*execution_context, match_tree_options).task;
+        auto bitset_task =
+            p::LiftedTask(fp::Parser(domain_filepath).parse_task(problem_filepath)).instantiate_ground_task(*execution_context, bitset_options).task;
+
+        ASSERT_NE(match_tree_task->get_action_match_tree(), nullptr);
+        ASSERT_NE(bitset_task->get_action_bitset_matcher(), nullptr);
+
+        auto match_tree_generator = p::SuccessorGenerator<p::GroundTag>(match_tree_task, execution_context);
+        auto bitset_generator = p::SuccessorGenerator<p::GroundTag>(bitset_task, execution_context);
+
+        const auto get_sorted_successors = [](auto& generator, const auto& node)
+        {
+            auto successors = generator.get_labeled_successor_nodes(node);
+            std::sort(successors.begin(), successors.end(), [](auto&& lhs, auto&& rhs) { return lhs.label.get_index() < rhs.label.get_index(); });
+            return successors;
+        };
+
+        auto match_tree_queue = std::vector<p::Node<p::GroundTag>> { match_tree_generator.get_initial_node() };
+        auto bitset_queue = std::vector<p::Node<p::GroundTag>> { bitset_generator.get_initial_node() };
+
+        for (size_t i = 0; i < match_tree_queue.size() && match_tree_queue.size() < 200; ++i)
+        {
+            const auto match_tree_successors = get_sorted_successors(match_tree_generator, match_tree_queue[i]);
+            const auto bitset_successors = get_sorted_successors(bitset_generator, bitset_queue[i]);
+
+            ASSERT_EQ(match_tree_successors.size(), bitset_successors.size());
+            for (size_t j = 0; j < match_tree_successors.size(); ++j)
+            {
+                EXPECT_EQ(match_tree_successors[j].label.get_index(), bitset_successors[j].label.get_index());
+                match_tree_queue.push_back(match_tree_successors[j].node);
+                bitset_queue.push_back(bitset_successors[j].node);
+            }
+        }
+    }
+}
+
+#if defined(TYR_STATE_STORAGE_DYNAMIC)
+class GroundTaskStateStorageMigrationTest : public ::testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(GroundTaskStateStorageMigrationTest, AutomaticStateStorageMigrationPreservesStates)
+{
+    auto ground_task = compute_ground_task(absolute(GetParam() + "/domain.pddl"), absolute(GetParam() + "/test-1.pddl"));
+
+    auto hash_set_options = p::StateStorageOptions();
+    hash_set_options.kind = p::StateStorageKind::HASH_SET;
+    auto automatic_options = p::StateStorageOptions();
+    automatic_options.kind = p::StateStorageKind::AUTOMATIC;
+    automatic_options.migration_threshold = 1;  // migrate right after the initial state is registered
+
+    auto hash_set_generator = p::SuccessorGenerator<p::GroundTag>(ground_task, ExecutionContext::create(1), hash_set_options);
+    auto automatic_generator = p::SuccessorGenerator<p::GroundTag>(ground_task, ExecutionContext::create(1), automatic_options);
+
+    auto hash_set_queue = std::vector<p::Node<p::GroundTag>> { hash_set_generator.get_initial_node() };
+    auto automatic_queue = std::vector<p::Node<p::GroundTag>> { automatic_generator.get_initial_node() };
+
+    for (size_t i = 0; i < hash_set_queue.size() && hash_set_queue.size() < 100; ++i)
+    {
+        const auto hash_set_successors = hash_set_generator.get_labeled_successor_nodes(hash_set_queue[i]);
+        const auto automatic_successors = automatic_generator.get_labeled_successor_nodes(automatic_queue[i]);
+
+        ASSERT_EQ(hash_set_successors.size(), automatic_successors.size());
+        for (size_t j = 0; j < hash_set_successors.size(); ++j)
+        {
+            EXPECT_EQ(hash_set_successors[j].node.get_state().get_index(), automatic_successors[j].node.get_state().get_index());
+            hash_set_queue.push_back(hash_set_successors[j].node);
+            automatic_queue.push_back(automatic_successors[j].node);
+        }
+    }
+
+    const auto& state_repository = automatic_generator.get_state_repository();
+    EXPECT_EQ(hash_set_generator.get_state_repository()->num_states(), state_repository->num_states());
+    for (uint_t i = 0; i < state_repository->num_states(); ++i)
+    {
+        const auto state_index = Index<p::State<p::GroundTag>>(i);
+        const auto expected_state = hash_set_generator.get_state_repository()->get_registered_state(state_index);
+        const auto state = state_repository->get_registered_state(state_index);
+        EXPECT_EQ(expected_state.get_fluent_values(), state.get_fluent_values());
+        EXPECT_EQ(expected_state.get_numeric_variables<f::FluentTag>(), state.get_numeric_variables<f::FluentTag>());
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TyrPlanningGroundTask,
+                         GroundTaskStateStorageMigrationTest,
+                         ::testing::Values("classical/gripper", "numeric/fo-counters", "numeric/refuel-adl"),
+                         [](const ::testing::TestParamInfo<std::string>& info)
+                         {
+                             auto name = info.param.substr(info.param.find('/') + 1);
+                             std::erase(name, '-');
+                             return name;
+                         });
+#endif
 }
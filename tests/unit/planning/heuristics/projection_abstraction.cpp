@@ -6,9 +6,18 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
+#include <cmath>
 #include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
 #include <sstream>
+#include <string>
 
+namespace f = tyr::formalism;
 namespace p = tyr::planning;
 namespace fp = tyr::formalism::planning;
 namespace json = boost::json;
@@ -140,4 +149,576 @@ INSTANTIATE_TEST_SUITE_P(
     {
         return make_test_name(info.param);
     });
-}
\ No newline at end of file
+
+TEST(TyrPlanningHeuristicsProjectionAbstraction, DistanceTableQuantizesDistances)
+{
+    const auto inf = std::numeric_limits<float_t>::infinity();
+
+    const auto check = [&](const std::vector<float_t>& distances, p::DistanceTable::Width expected_width)
+    {
+        const auto table = p::DistanceTable(distances);
+        EXPECT_EQ(table.get_width(), expected_width);
+        ASSERT_EQ(table.size(), distances.size());
+        for (uint_t i = 0; i < distances.size(); ++i)
+            EXPECT_EQ(table[i], distances[i]);
+    };
+
+    check({ 0, 3, inf, 254 }, p::DistanceTable::Width::BITS_8);
+    check({ 0, 255, inf }, p::DistanceTable::Width::BITS_16);
+    check({ 0, 65535, inf }, p::DistanceTable::Width::FULL);
+    check({ 0, 1.5, inf }, p::DistanceTable::Width::FULL);
+}
+
+namespace
+{
+struct CollectionTestCase
+{
+    std::string name;
+    std::string subdir;  ///< relative to data/tests/classical
+    std::string problem;
+};
+
+/// @brief A lifted task with several goal atoms, the projections onto its goal patterns, and its initial state.
+class ProjectionCollectionTest : public ::testing::TestWithParam<CollectionTestCase>
+{
+protected:
+    void SetUp() override
+    {
+        const auto directory = repo_root() / "data/tests/classical" / GetParam().subdir;
+        lifted_task = compute_lifted_task(directory / "domain.pddl", directory / GetParam().problem);
+        goal_patterns = p::GoalPatternGenerator<p::LiftedTag>(lifted_task).generate();
+        projections = p::ProjectionGenerator<p::LiftedTag>(lifted_task, goal_patterns).generate();
+        state_repository = p::StateRepository<p::LiftedTag>::create(lifted_task, ExecutionContext::create(1));
+        initial_state.emplace(state_repository->get_initial_state());
+    }
+
+    /// @brief Compute the cost of an optimal plan by blind A*.
+    float_t compute_optimal_plan_cost() const
+    {
+        auto successor_generator = p::SuccessorGenerator<p::LiftedTag>(lifted_task, ExecutionContext::create(1));
+        auto heuristic = p::BlindHeuristic<p::LiftedTag>::create();
+        const auto result = p::astar_eager::find_solution(*lifted_task, successor_generator, *heuristic);
+        EXPECT_EQ(result.status, p::SearchStatus::SOLVED);
+        return result.plan.has_value() ? result.plan->get_cost() : std::numeric_limits<float_t>::infinity();
+    }
+
+    /// @brief Collect the states reached by breadth-first search from the initial state, up to the given number.
+    std::vector<p::StateView<p::LiftedTag>> collect_reachable_states(size_t max_states) const
+    {
+        auto successor_generator = p::SuccessorGenerator<p::LiftedTag>(lifted_task, ExecutionContext::create(1));
+        auto nodes = std::vector<p::Node<p::LiftedTag>> { successor_generator.get_initial_node() };
+        auto seen = UnorderedSet<Index<p::State<p::LiftedTag>>> { nodes.front().get_state().get_index() };
+
+        for (size_t i = 0; i < nodes.size() && nodes.size() < max_states; ++i)
+            for (const auto& successor : successor_generator.get_labeled_successor_nodes(nodes[i]))
+                if (nodes.size() < max_states && seen.insert(successor.node.get_state().get_index()).second)
+                    nodes.push_back(successor.node);
+
+        auto result = std::vector<p::StateView<p::LiftedTag>> {};
+        for (const auto& node : nodes)
+            result.push_back(node.get_state());
+        return result;
+    }
+
+    /// @brief Pair the first goal atom with the initial atom of the same predicate and first object, which are mutex in the tested domains.
+    fp::GroundAtomViewList<f::FluentTag> compute_goal_mutex_group() const
+    {
+        const auto goal_atom = goal_patterns[0].facts.front().get_atom().value();
+        auto result = fp::GroundAtomViewList<f::FluentTag> { goal_atom };
+        for (const auto atom : lifted_task->get_task().get_atoms<f::FluentTag>())
+            if (atom.get_predicate().get_index() == goal_atom.get_predicate().get_index()
+                && atom.get_row().get_objects().front().get_index() == goal_atom.get_row().get_objects().front().get_index())
+                result.push_back(atom);
+        return result;
+    }
+
+    p::LiftedTaskPtr lifted_task;
+    p::PatternCollection goal_patterns;
+    p::ProjectionAbstractionList<p::LiftedTag> projections;
+    std::shared_ptr<p::StateRepository<p::LiftedTag>> state_repository;
+    std::optional<p::StateView<p::LiftedTag>> initial_state;
+};
+}
+
+TEST_P(ProjectionCollectionTest, ProjectionCacheReproducesProjections)
+{
+    // Each run writes to its own directory, such that parallel runs do not interfere.
+    const auto cache_directory = fs::temp_directory_path() / ("tyr_projection_cache_test_" + GetParam().name + "_" + std::to_string(std::random_device {}()));
+    fs::remove_all(cache_directory);
+
+    auto options = p::ProjectionGeneratorOptions();
+    options.cache_directory = cache_directory;
+
+    auto generator = p::ProjectionGenerator<p::LiftedTag>(lifted_task, goal_patterns, options);
+    const auto generated = generator.generate();
+    EXPECT_EQ(generator.get_statistics().num_loaded_projections, uint_t(0));
+    EXPECT_EQ(generator.get_statistics().num_stored_projections, generated.size());
+
+    auto cache_files = std::vector<fs::path> {};
+    for (const auto& entry : fs::directory_iterator(cache_directory))
+        if (entry.path().extension() == ".pdb")
+            cache_files.push_back(entry.path());
+    EXPECT_EQ(cache_files.size(), generated.size());
+
+    auto loading_generator = p::ProjectionGenerator<p::LiftedTag>(lifted_task, goal_patterns, options);
+    const auto loaded = loading_generator.generate();
+    EXPECT_EQ(loading_generator.get_statistics().num_loaded_projections, generated.size());
+    EXPECT_EQ(loading_generator.get_statistics().num_stored_projections, uint_t(0));
+
+    ASSERT_EQ(generated.size(), loaded.size());
+    for (size_t i = 0; i < generated.size(); ++i)
+    {
+        const auto& lhs = generated[i].get_forward();
+        const auto& rhs = loaded[i].get_forward();
+        EXPECT_EQ(lhs.num_vertices(), rhs.num_vertices());
+        EXPECT_EQ(lhs.num_edges(), rhs.num_edges());
+        EXPECT_EQ(lhs.goal_vertices(), rhs.goal_vertices());
+        EXPECT_EQ(lhs.labels().size(), rhs.labels().size());
+        EXPECT_EQ(lhs.offsets(), rhs.offsets());
+
+        for (uint_t t = 0; t < lhs.num_edges(); ++t)
+        {
+            EXPECT_EQ(lhs.get_target(t), rhs.get_target(t));
+            EXPECT_EQ(lhs.get_label(t).original_action.get_index(), rhs.get_label(t).original_action.get_index());
+            EXPECT_TRUE(EqualTo<tyr::formalism::unification::SubstitutionFunction<Index<tyr::formalism::Object>>> {}(lhs.get_label(t).substitution,
+                                                                                                                    rhs.get_label(t).substitution));
+        }
+
+        for (uint_t s = 0; s < lhs.num_vertices(); ++s)
+            EXPECT_EQ((*generated[i].get_distances())[s], (*loaded[i].get_distances())[s]);
+    }
+
+    // A file whose header announces more transitions than it contains is rejected and regenerated.
+    ASSERT_FALSE(cache_files.empty());
+    {
+        const auto num_transitions_offset = 5 * sizeof(uint64_t);
+        const auto corrupt_count = std::numeric_limits<uint64_t>::max() / 2;
+        auto file = std::fstream(cache_files.front(), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(num_transitions_offset);
+        file.write(reinterpret_cast<const char*>(&corrupt_count), sizeof(corrupt_count));
+    }
+
+    auto repairing_generator = p::ProjectionGenerator<p::LiftedTag>(lifted_task, goal_patterns, options);
+    EXPECT_EQ(repairing_generator.generate().size(), generated.size());
+    EXPECT_EQ(repairing_generator.get_statistics().num_loaded_projections, generated.size() - 1);
+    EXPECT_EQ(repairing_generator.get_statistics().num_stored_projections, uint_t(1));
+
+    fs::remove_all(cache_directory);
+}
+
+TEST_P(ProjectionCollectionTest, ProjectionCacheRejectsStaleFiles)
+{
+    const auto cache_directory = fs::temp_directory_path() / ("tyr_projection_cache_stale_test_" + GetParam().name + "_" + std::to_string(std::random_device {}()));
+    fs::remove_all(cache_directory);
+
+    auto options = p::ProjectionGeneratorOptions();
+    options.cache_directory = cache_directory;
+
+    const auto generated = p::ProjectionGenerator<p::LiftedTag>(lifted_task, goal_patterns, options).generate();
+
+    auto cache_files = std::vector<fs::path> {};
+    for (const auto& entry : fs::directory_iterator(cache_directory))
+        if (entry.path().extension() == ".pdb")
+            cache_files.push_back(entry.path());
+    ASSERT_EQ(cache_files.size(), generated.size());
+    ASSERT_GE(cache_files.size(), size_t(2));
+
+    // The first file is of version 2, whose distances are unit-cost distances.
+    {
+        const auto version_2_magic = uint64_t(0x0002'4244'5052'5954);
+        auto file = std::fstream(cache_files[0], std::ios::binary | std::ios::in | std::ios::out);
+        file.write(reinterpret_cast<const char*>(&version_2_magic), sizeof(version_2_magic));
+    }
+
+    // The second file was written under another cost model: the last label cost, which ends the file, differs.
+    {
+        const auto other_cost = float_t { 1000 };
+        auto file = std::fstream(cache_files[1], std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-std::streamoff(sizeof(other_cost)), std::ios::end);
+        file.write(reinterpret_cast<const char*>(&other_cost), sizeof(other_cost));
+    }
+
+    auto generator = p::ProjectionGenerator<p::LiftedTag>(lifted_task, goal_patterns, options);
+    generator.generate();
+    EXPECT_EQ(generator.get_statistics().num_loaded_projections, generated.size() - 2);
+    EXPECT_EQ(generator.get_statistics().num_stored_projections, uint_t(2));
+
+    fs::remove_all(cache_directory);
+}
+
+TEST_P(ProjectionCollectionTest, HillClimbingPatternGeneratorExtendsGoalPatterns)
+{
+    auto options = p::HillClimbingPatternGeneratorOptions();
+    options.max_time = std::chrono::seconds(10);
+    options.max_pdb_size = 16;
+    options.num_samples = 50;
+
+    const auto patterns = p::HillClimbingPatternGenerator<p::LiftedTag>(lifted_task, options).generate();
+
+    // Each goal atom needs the vehicle at its destination, which the goal patterns ignore, such that some extension must be added.
+    ASSERT_GT(patterns.size(), goal_patterns.size());
+    for (size_t i = 0; i < goal_patterns.size(); ++i)
+        EXPECT_EQ(patterns[i].facts_set, goal_patterns[i].facts_set);
+
+    const auto extended_projections = p::ProjectionGenerator<p::LiftedTag>(lifted_task, patterns).generate();
+    for (size_t i = goal_patterns.size(); i < extended_projections.size(); ++i)
+        EXPECT_LE(extended_projections[i].get_forward().num_vertices(), options.max_pdb_size);
+
+    const auto h = p::CanonicalHeuristic<p::LiftedTag>(extended_projections).evaluate(*initial_state);
+    EXPECT_GT(h, p::CanonicalHeuristic<p::LiftedTag>(projections).evaluate(*initial_state));
+    EXPECT_LE(h, compute_optimal_plan_cost());
+}
+
+TEST_P(ProjectionCollectionTest, SaturatedCostPartitioningIsAdmissibleAndDominatesCanonical)
+{
+    ASSERT_GE(projections.size(), size_t(2));
+
+    // With a single projection, the saturated cost partitioning assigns it all costs.
+    const auto first = p::ProjectionAbstractionList<p::LiftedTag> { projections.front() };
+    EXPECT_EQ(p::SaturatedCostPartitioningHeuristic<p::LiftedTag>(first).evaluate(*initial_state),
+              p::ProjectionAbstractionHeuristic<p::LiftedTag>(projections.front()).evaluate(*initial_state));
+
+    auto options = p::SaturatedCostPartitioningOptions();
+    options.max_orders = 10;
+    auto heuristic = p::SaturatedCostPartitioningHeuristic<p::LiftedTag>(projections, { *initial_state }, options);
+    EXPECT_GE(heuristic.num_orders(), size_t(1));
+    EXPECT_LE(heuristic.num_orders(), options.max_orders);
+
+    // The goal atoms are achieved by actions on different objects, whose labels cannot match a common ground action and thus keep their costs.
+    const auto h = heuristic.evaluate(*initial_state);
+    EXPECT_GE(h, p::CanonicalHeuristic<p::LiftedTag>(projections).evaluate(*initial_state));
+    EXPECT_LE(h, compute_optimal_plan_cost());
+}
+
+TEST_P(ProjectionCollectionTest, CanonicalHeuristicSharesComponentsOfEqualPatterns)
+{
+    auto duplicated = projections;
+    duplicated.insert(duplicated.end(), projections.begin(), projections.end());
+
+    auto heuristic = p::CanonicalHeuristic<p::LiftedTag>(projections);
+    auto duplicated_heuristic = p::CanonicalHeuristic<p::LiftedTag>(duplicated);
+    EXPECT_EQ(duplicated_heuristic.num_components(), heuristic.num_components());
+    EXPECT_EQ(duplicated_heuristic.num_cliques(), heuristic.num_cliques());
+    EXPECT_EQ(duplicated_heuristic.evaluate(*initial_state), heuristic.evaluate(*initial_state));
+}
+
+TEST_P(ProjectionCollectionTest, CanonicalHeuristicPrunesDominatedCliques)
+{
+    ASSERT_GE(goal_patterns.size(), size_t(2));
+
+    // The projections onto {A} and {B} are additive, and the projection onto {A, B} overlaps with both, such that the clique {A, B}
+    // dominates the clique of {A} and {B}.
+    auto facts = goal_patterns[0].facts;
+    facts.insert(facts.end(), goal_patterns[1].facts.begin(), goal_patterns[1].facts.end());
+    const auto overlapping = p::ProjectionAbstractionList<p::LiftedTag> {
+        projections[0],
+        projections[1],
+        p::ProjectionGenerator<p::LiftedTag>(lifted_task, p::PatternCollection { p::Pattern(std::move(facts)) }).generate().front()
+    };
+
+    const auto cliques = p::compute_maximal_additive_subsets(overlapping);
+    ASSERT_EQ(cliques.size(), size_t(2));
+
+    auto heuristic = p::CanonicalHeuristic<p::LiftedTag>(overlapping);
+    EXPECT_EQ(heuristic.num_components(), size_t(3));
+    EXPECT_EQ(heuristic.num_cliques(), size_t(1));
+
+    // The pruned heuristic equals the maximum over all maximal cliques.
+    const auto heuristics = create_projection_abstraction_heuristics(overlapping);
+    for (const auto& state : collect_reachable_states(100))
+    {
+        const auto values = evaluate_heuristics(heuristics, state);
+
+        auto expected = float_t(0);
+        for (const auto& clique : cliques)
+        {
+            auto h_sum = float_t(0);
+            for (const auto i : clique)
+                h_sum += values[i];
+            expected = std::max(expected, h_sum);
+        }
+
+        EXPECT_EQ(heuristic.evaluate(state), expected);
+    }
+}
+
+TEST_P(ProjectionCollectionTest, CanonicalHeuristicSeparatesComponentsOfDifferentMutexGroups)
+{
+    const auto mutex_group = compute_goal_mutex_group();
+    ASSERT_EQ(mutex_group.size(), size_t(2));
+
+    const auto pattern = p::Pattern(fp::FDRFactViewList<f::FluentTag> { goal_patterns[0].facts.front(), lifted_task->get_fdr_context()->get_fact_view(mutex_group[1]) });
+
+    auto options = p::ProjectionGeneratorOptions();
+    options.mutex_groups = { mutex_group };
+    const auto plain = p::ProjectionGenerator<p::LiftedTag>(lifted_task, p::PatternCollection { pattern }).generate().front();
+    const auto grouped = p::ProjectionGenerator<p::LiftedTag>(lifted_task, p::PatternCollection { pattern }, options).generate().front();
+    ASSERT_LT(grouped.get_mapping().num_abstract_states(), plain.get_mapping().num_abstract_states());
+
+    auto heuristic = p::CanonicalHeuristic<p::LiftedTag>(p::ProjectionAbstractionList<p::LiftedTag> { plain, grouped });
+    EXPECT_EQ(heuristic.num_components(), size_t(2));
+    EXPECT_EQ(heuristic.evaluate(*initial_state), p::ProjectionAbstractionHeuristic<p::LiftedTag>(plain).evaluate(*initial_state));
+}
+
+TEST_P(ProjectionCollectionTest, IncrementalEvaluationMatchesEvaluation)
+{
+    auto heuristics = create_projection_abstraction_heuristics(projections);
+    heuristics.push_back(p::GoalCountHeuristic<p::LiftedTag>::create(lifted_task));
+    for (const auto& heuristic : heuristics)
+        EXPECT_TRUE(heuristic->has_incremental_evaluation());
+
+    // Expand the states in breadth-first order, such that each state is the cached predecessor of several successors in a row.
+    auto successor_generator = p::SuccessorGenerator<p::LiftedTag>(lifted_task, ExecutionContext::create(1));
+    auto nodes = std::vector<p::Node<p::LiftedTag>> { successor_generator.get_initial_node() };
+    for (size_t i = 0; i < nodes.size() && i < 50; ++i)
+    {
+        const auto state = nodes[i].get_state();
+        const auto values = evaluate_heuristics(heuristics, state);
+
+        for (const auto& successor : successor_generator.get_labeled_successor_nodes(nodes[i]))
+        {
+            const auto succ_state = successor.node.get_state();
+            for (size_t h = 0; h < heuristics.size(); ++h)
+                EXPECT_EQ(heuristics[h]->evaluate_successor(state, values[h], successor.label, succ_state), heuristics[h]->evaluate(succ_state));
+            nodes.push_back(successor.node);
+        }
+    }
+
+    // A state of another state repository can have the index of the cached state, which must not be mistaken for it.
+    // The other repository only registers the successor by the last applicable action, which gets the index of another state in the first repository.
+    auto other_generator = p::SuccessorGenerator<p::LiftedTag>(lifted_task, ExecutionContext::create(1));
+    const auto other_initial_node = other_generator.get_initial_node();
+    auto actions = std::vector<fp::GroundActionView> {};
+    other_generator.get_applicable_actions(other_initial_node, actions);
+    ASSERT_FALSE(actions.empty());
+    const auto other_node = other_generator.get_successor_node(other_initial_node, actions.back());
+
+    const auto cached_it = std::find_if(nodes.begin(),
+                                        nodes.end(),
+                                        [&](const auto& node) { return uint_t(node.get_state().get_index()) == uint_t(other_node.get_state().get_index()); });
+    ASSERT_TRUE(cached_it != nodes.end());
+    const auto& cached = *cached_it;
+
+    const auto get_atoms = [](const p::StateView<p::LiftedTag>& state)
+    {
+        auto result = std::vector<uint_t> {};
+        for (const auto fact : state.get_fluent_facts())
+            result.push_back(uint_t(fact.variable));
+        return result;
+    };
+    ASSERT_NE(get_atoms(cached.get_state()), get_atoms(other_node.get_state()));
+
+    actions.clear();
+    other_generator.get_applicable_actions(other_node, actions);
+    ASSERT_FALSE(actions.empty());
+    const auto other_succ_state = other_generator.get_successor_node(other_node, actions.front()).get_state();
+
+    auto cached_successors = successor_generator.get_labeled_successor_nodes(cached);
+    ASSERT_FALSE(cached_successors.empty());
+
+    for (const auto& heuristic : heuristics)
+    {
+        const auto cached_state = cached.get_state();
+        heuristic->evaluate_successor(cached_state, heuristic->evaluate(cached_state), cached_successors.front().label, cached_successors.front().node.get_state());
+
+        const auto other_state = other_node.get_state();
+        EXPECT_EQ(heuristic->evaluate_successor(other_state, heuristic->evaluate(other_state), actions.front(), other_succ_state),
+                  heuristic->evaluate(other_succ_state));
+    }
+}
+
+TEST_P(ProjectionCollectionTest, MutexGroupsShrinkProjectionsAdmissibly)
+{
+    const auto mutex_group = compute_goal_mutex_group();
+    ASSERT_EQ(mutex_group.size(), size_t(2));
+
+    auto facts = fp::FDRFactViewList<f::FluentTag> {};
+    for (const auto atom : mutex_group)
+        facts.push_back(lifted_task->get_fdr_context()->get_fact_view(atom));
+    const auto patterns = p::PatternCollection { p::Pattern(facts) };
+
+    auto options = p::ProjectionGeneratorOptions();
+    options.mutex_groups = { mutex_group };
+    const auto plain = p::ProjectionGenerator<p::LiftedTag>(lifted_task, patterns).generate().front();
+    const auto grouped = p::ProjectionGenerator<p::LiftedTag>(lifted_task, patterns, options).generate().front();
+
+    // The abstract state in which both atoms hold is not represented.
+    EXPECT_EQ(plain.get_mapping().num_abstract_states(), uint_t(4));
+    EXPECT_EQ(grouped.get_mapping().num_abstract_states(), uint_t(3));
+
+    // Removing spurious abstract states can only increase the estimates, which remain admissible.
+    auto plain_heuristic = p::ProjectionAbstractionHeuristic<p::LiftedTag>(plain);
+    auto grouped_heuristic = p::ProjectionAbstractionHeuristic<p::LiftedTag>(grouped);
+    for (const auto& state : collect_reachable_states(100))
+    {
+        const auto h = grouped_heuristic.evaluate(state);
+        EXPECT_TRUE(std::isfinite(h));
+        EXPECT_GE(h, plain_heuristic.evaluate(state));
+    }
+    EXPECT_LE(grouped_heuristic.evaluate(*initial_state), compute_optimal_plan_cost());
+}
+
+TEST_P(ProjectionCollectionTest, MutexViolatingStatesMapToDeadEndRank)
+{
+    const auto mutex_group = compute_goal_mutex_group();
+    ASSERT_EQ(mutex_group.size(), size_t(2));
+
+    auto facts = fp::FDRFactViewList<f::FluentTag> {};
+    for (const auto atom : mutex_group)
+        facts.push_back(lifted_task->get_fdr_context()->get_fact_view(atom));
+
+    auto options = p::ProjectionGeneratorOptions();
+    options.mutex_groups = { mutex_group };
+    const auto grouped = p::ProjectionGenerator<p::LiftedTag>(lifted_task, p::PatternCollection { p::Pattern(facts) }, options).generate().front();
+    const auto& mapping = grouped.get_mapping();
+    ASSERT_EQ(mapping.get_groups().size(), size_t(1));
+
+    // Both atoms of the mutex group hold, which no abstract state represents.
+    const auto state = state_repository->create_state(facts, {});
+    EXPECT_EQ(mapping.map_state(state), mapping.dead_end_rank());
+    EXPECT_EQ(mapping.dead_end_rank(), mapping.num_abstract_states());
+    EXPECT_EQ((*grouped.get_distances())[mapping.dead_end_rank()], std::numeric_limits<float_t>::infinity());
+    EXPECT_EQ(p::ProjectionAbstractionHeuristic<p::LiftedTag>(grouped).evaluate(state), std::numeric_limits<float_t>::infinity());
+    EXPECT_EQ(p::CanonicalHeuristic<p::LiftedTag>(p::ProjectionAbstractionList<p::LiftedTag> { grouped }).evaluate(state),
+              std::numeric_limits<float_t>::infinity());
+
+    // Without the mutex group, the state maps to the abstract state in which both facts hold.
+    const auto plain = p::ProjectionMapping<p::LiftedTag>(p::Pattern(facts));
+    EXPECT_LT(plain.map_state(state), plain.num_abstract_states());
+    EXPECT_LT(mapping.map_state(*initial_state), mapping.num_abstract_states());
+}
+
+INSTANTIATE_TEST_SUITE_P(TyrPlanningHeuristicsProjectionAbstraction,
+                         ProjectionCollectionTest,
+                         ::testing::Values(CollectionTestCase { "Gripper", "gripper", "test-2.pddl" }, CollectionTestCase { "Ferry", "ferry", "test-1.pddl" }),
+                         [](const ::testing::TestParamInfo<CollectionTestCase>& info) { return info.param.name; });
+
+TEST(TyrPlanningHeuristicsProjectionAbstraction, ProjectionsUseActionCostLowerBounds)
+{
+    const auto directory = repo_root() / "data/tests/classical/woodworking";
+    auto lifted_task = compute_lifted_task(directory / "domain.pddl", directory / "test-1.pddl");
+    const auto patterns = p::GoalPatternGenerator<p::LiftedTag>(lifted_task).generate();
+    const auto projections = p::ProjectionGenerator<p::LiftedTag>(lifted_task, patterns).generate();
+
+    auto state_repository = p::StateRepository<p::LiftedTag>::create(lifted_task, ExecutionContext::create(1));
+    const auto initial_state = state_repository->get_initial_state();
+
+    // The cost of a schema is its constant increase of the total cost, or the smallest value of its cost function over the parts.
+    const auto min_cost = float_t { 5 };
+    const auto expected_costs = std::map<std::string, float_t> {
+        { "do-immersion-varnish", 10 },
+        { "do-spray-varnish", 5 },
+        { "do-glaze", 10 },
+        { "do-grind", 15 },
+        { "do-plane", 10 },
+        { "load-highspeed-saw", 30 },
+        { "unload-highspeed-saw", 10 },
+        { "cut-board-small", 10 },
+        { "cut-board-medium", 10 },
+        { "cut-board-large", 10 },
+        { "do-saw-small", 30 },
+        { "do-saw-medium", 30 },
+        { "do-saw-large", 30 },
+    };
+
+    auto max_h = float_t { 0 };
+    for (const auto& projection : projections)
+    {
+        const auto& forward = projection.get_forward();
+        const auto& label_costs = projection.get_label_costs();
+
+        ASSERT_EQ(label_costs.size(), forward.labels().size());
+        for (uint_t l = 0; l < label_costs.size(); ++l)
+            EXPECT_EQ(label_costs[l], expected_costs.at(std::string(forward.labels()[l].original_action.get_name())));
+
+        // The distances solve the Bellman equations under the label costs, and thus exceed the unit-cost distances by the smallest cost.
+        const auto& distances = *projection.get_distances();
+        const auto unit = p::ProjectionAbstraction<p::LiftedTag>(std::make_shared<const p::ForwardProjectionAbstraction<p::LiftedTag>>(forward));
+        for (uint_t v = 0; v < forward.num_vertices(); ++v)
+        {
+            const auto is_goal = std::find(forward.goal_vertices().begin(), forward.goal_vertices().end(), v) != forward.goal_vertices().end();
+
+            auto expected = is_goal ? float_t { 0 } : std::numeric_limits<float_t>::infinity();
+            for (const auto t : forward.get_transitions(v))
+                expected = std::min(expected, label_costs[forward.get_label_index(t)] + distances[forward.get_target(t)]);
+
+            EXPECT_EQ(distances[v], expected);
+            EXPECT_GE(distances[v], min_cost * (*unit.get_distances())[v]);
+        }
+
+        // The saturated cost partitioning starts from the label costs, such that it keeps the estimates of a single projection.
+        const auto h = p::ProjectionAbstractionHeuristic<p::LiftedTag>(projection).evaluate(initial_state);
+        EXPECT_EQ(p::SaturatedCostPartitioningHeuristic<p::LiftedTag>(p::ProjectionAbstractionList<p::LiftedTag> { projection }).evaluate(initial_state), h);
+        max_h = std::max(max_h, h);
+    }
+
+    // Some goal atoms do not hold in the initial state, and the first projection of the order keeps all costs.
+    EXPECT_GE(max_h, min_cost);
+    EXPECT_GE(p::SaturatedCostPartitioningHeuristic<p::LiftedTag>(projections).evaluate(initial_state),
+              p::ProjectionAbstractionHeuristic<p::LiftedTag>(projections.front()).evaluate(initial_state));
+}
+
+namespace
+{
+/// A reversed transition system in compressed sparse row format, see distance_engine.hpp.
+struct ReversedGraph
+{
+    std::vector<uint_t> m_offsets;
+    std::vector<uint_t> m_sources;
+    std::vector<uint_t> m_transitions;
+    std::vector<uint_t> m_goal_vertices;
+
+    /// @param transitions are the forward transitions as pairs of source and target.
+    ReversedGraph(uint_t num_vertices, const std::vector<std::pair<uint_t, uint_t>>& transitions, std::vector<uint_t> goal_vertices) :
+        m_offsets(num_vertices + 1, 0),
+        m_sources(),
+        m_transitions(),
+        m_goal_vertices(std::move(goal_vertices))
+    {
+        for (uint_t v = 0; v < num_vertices; ++v)
+        {
+            for (uint_t t = 0; t < transitions.size(); ++t)
+            {
+                if (transitions[t].second == v)
+                {
+                    m_sources.push_back(transitions[t].first);
+                    m_transitions.push_back(t);
+                }
+            }
+            m_offsets[v + 1] = m_sources.size();
+        }
+    }
+
+    size_t num_vertices() const { return m_offsets.size() - 1; }
+    size_t num_edges() const { return m_sources.size(); }
+    const auto& offsets() const { return m_offsets; }
+    const auto& sources() const { return m_sources; }
+    const auto& transitions() const { return m_transitions; }
+    const auto& goal_vertices() const { return m_goal_vertices; }
+};
+}
+
+TEST(TyrPlanningHeuristicsProjectionAbstraction, DistanceEngineAlgorithmsAgree)
+{
+    const auto inf = std::numeric_limits<float_t>::infinity();
+
+    // 0 -> 1 -> 3 (goal), 0 -> 2 -> 3, 2 -> 2, and 4 is a dead end.
+    const auto graph = ReversedGraph(5, { { 0, 1 }, { 1, 3 }, { 0, 2 }, { 2, 3 }, { 2, 2 }, { 4, 0 }, { 3, 4 } }, { 3 });
+
+    const auto unit = std::vector<float_t>(7, 1);
+    EXPECT_EQ(p::select_distance_algorithm(unit), p::DistanceAlgorithm::BFS);
+    EXPECT_EQ(p::compute_goal_distances(graph, unit), (std::vector<float_t> { 2, 1, 1, 0, 3 }));
+
+    const auto integral = std::vector<float_t> { 1, 5, 2, 0, 7, 1, 3 };
+    EXPECT_EQ(p::select_distance_algorithm(integral), p::DistanceAlgorithm::DIAL);
+    EXPECT_EQ(p::compute_goal_distances(graph, integral), (std::vector<float_t> { 2, 5, 0, 0, 3 }));
+    EXPECT_EQ(p::compute_goal_distances_radix_heap(graph, integral), (std::vector<float_t> { 2, 5, 0, 0, 3 }));
+
+    const auto general = std::vector<float_t> { 0.5, 0.25, 1.5, 2.5, 0.125, 1, 0 };
+    EXPECT_EQ(p::select_distance_algorithm(general), p::DistanceAlgorithm::RADIX_HEAP);
+    EXPECT_EQ(p::compute_goal_distances(graph, general), (std::vector<float_t> { 0.75, 0.25, 2.5, 0, 1.75 }));
+
+    const auto unreachable = ReversedGraph(3, { { 0, 1 } }, { 1 });
+    EXPECT_EQ(p::compute_goal_distances(unreachable, std::vector<float_t> { 2 }), (std::vector<float_t> { 2, 0, inf }));
+}
+}
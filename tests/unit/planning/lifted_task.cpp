@@ -20,7 +20,9 @@
 #include <tyr/planning/planning.hpp>
 
 #include <algorithm>
+#include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace p = tyr::planning;
 namespace f = tyr::formalism;
@@ -42,6 +44,31 @@ p::SuccessorGenerator<p::LiftedTag> create_successor_generator(std::shared_ptr<p
 
 fs::path absolute(const std::string& subdir) { return fs::path(std::string(ROOT_DIR)) / "data" / "tests" / subdir; }
 
+/// @brief Replay the plan from the initial state by applying its actions, and expect that each action is applicable and the last state is a goal.
+void expect_valid_plan(const p::Task<p::LiftedTag>& task, p::SuccessorGenerator<p::LiftedTag>& successor_generator, const p::Plan<p::LiftedTag>& plan)
+{
+    auto node = successor_generator.get_initial_node();
+    for (const auto& step : plan.get_labeled_succ_nodes())
+    {
+        const auto successors = successor_generator.get_labeled_successor_nodes(node);
+        const auto it = std::ranges::find_if(successors, [&](const auto& successor) { return successor.label.get_index() == step.label.get_index(); });
+        ASSERT_TRUE(it != successors.end()) << "the plan applies an inapplicable action";
+        node = it->node;
+    }
+
+    EXPECT_TRUE(p::TaskGoalStrategy<p::LiftedTag>(task).is_dynamic_goal_satisfied(node.get_state()));
+}
+
+/// @brief Find a successor of the node by the name of its action that reaches a different state.
+p::Node<p::LiftedTag> get_successor(p::SuccessorGenerator<p::LiftedTag>& successor_generator, const p::Node<p::LiftedTag>& node, const std::string& action_name)
+{
+    for (const auto& successor : successor_generator.get_labeled_successor_nodes(node))
+        if (std::string(successor.label.get_action().get_name()) == action_name && successor.node.get_state().get_index() != node.get_state().get_index())
+            return successor.node;
+
+    throw std::runtime_error("get_successor: no successor by " + action_name);
+}
+
 struct LiftedSuccessorCountCase
 {
     std::string name;
@@ -199,4 +226,134 @@ INSTANTIATE_TEST_SUITE_P(TyrPlanningLiftedTask,
                                            LiftedSuccessorCountCase { "Woodworking", "classical/woodworking", 8 },
                                            LiftedSuccessorCountCase { "Zenotravel", "numeric/zenotravel", 7 }),
                          test_name);
+
+#if defined(TYR_STATE_STORAGE_DYNAMIC)
+class LiftedTaskStateStorageMigrationTest : public ::testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(LiftedTaskStateStorageMigrationTest, AutomaticStateStorageMigrationPreservesStates)
+{
+    auto lifted_task = compute_lifted_task(absolute(GetParam() + "/domain.pddl"), absolute(GetParam() + "/test-1.pddl"));
+
+    auto hash_set_options = p::StateStorageOptions();
+    hash_set_options.kind = p::StateStorageKind::HASH_SET;
+    auto automatic_options = p::StateStorageOptions();
+    automatic_options.kind = p::StateStorageKind::AUTOMATIC;
+    automatic_options.migration_threshold = 1;  // migrate right after the initial state is registered
+
+    auto hash_set_generator = p::SuccessorGenerator<p::LiftedTag>(lifted_task, ExecutionContext::create(1), hash_set_options);
+    auto automatic_generator = p::SuccessorGenerator<p::LiftedTag>(lifted_task, ExecutionContext::create(1), automatic_options);
+
+    auto hash_set_queue = std::vector<p::Node<p::LiftedTag>> { hash_set_generator.get_initial_node() };
+    auto automatic_queue = std::vector<p::Node<p::LiftedTag>> { automatic_generator.get_initial_node() };
+
+    for (size_t i = 0; i < hash_set_queue.size() && hash_set_queue.size() < 100; ++i)
+    {
+        const auto hash_set_successors = hash_set_generator.get_labeled_successor_nodes(hash_set_queue[i]);
+        const auto automatic_successors = automatic_generator.get_labeled_successor_nodes(automatic_queue[i]);
+
+        ASSERT_EQ(hash_set_successors.size(), automatic_successors.size());
+        for (size_t j = 0; j < hash_set_successors.size(); ++j)
+        {
+            EXPECT_EQ(hash_set_successors[j].node.get_state().get_index(), automatic_successors[j].node.get_state().get_index());
+            hash_set_queue.push_back(hash_set_successors[j].node);
+            automatic_queue.push_back(automatic_successors[j].node);
+        }
+    }
+
+    const auto to_pair = [](const auto& fact) { return std::pair(fact.variable, fact.value); };
+
+    const auto& state_repository = automatic_generator.get_state_repository();
+    EXPECT_EQ(hash_set_generator.get_state_repository()->num_states(), state_repository->num_states());
+    for (uint_t i = 0; i < state_repository->num_states(); ++i)
+    {
+        const auto state_index = Index<p::State<p::LiftedTag>>(i);
+        const auto expected_state = hash_set_generator.get_state_repository()->get_registered_state(state_index);
+        const auto state = state_repository->get_registered_state(state_index);
+        EXPECT_TRUE(std::ranges::equal(expected_state.get_fluent_facts(), state.get_fluent_facts(), {}, to_pair, to_pair));
+        EXPECT_TRUE(std::ranges::equal(expected_state.get_fluent_fterm_values(), state.get_fluent_fterm_values()));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TyrPlanningLiftedTask,
+                         LiftedTaskStateStorageMigrationTest,
+                         ::testing::Values("classical/gripper", "numeric/fo-counters", "numeric/refuel-adl"),
+                         [](const ::testing::TestParamInfo<std::string>& info)
+                         {
+                             auto name = info.param.substr(info.param.find('/') + 1);
+                             std::erase(name, '-');
+                             return name;
+                         });
+#endif
+
+TEST(TyrPlanningLiftedTask, AStarEagerStopsAtMemoryLimit)
+{
+    auto lifted_task = compute_lifted_task(absolute("classical/gripper/domain.pddl"), absolute("classical/gripper/test-1.pddl"));
+    auto successor_generator = create_successor_generator(lifted_task);
+    auto heuristic = p::BlindHeuristic<p::LiftedTag>::create();
+
+    auto options = p::astar_eager::Options<p::LiftedTag>();
+    options.max_memory = 1;
+    const auto result = p::astar_eager::find_solution(*lifted_task, successor_generator, *heuristic, options);
+
+    EXPECT_EQ(result.status, p::SearchStatus::OUT_OF_MEMORY);
+    EXPECT_FALSE(result.plan.has_value());
+}
+
+TEST(TyrPlanningLiftedTask, WidthBasedSearchSolvesTasks)
+{
+    for (const auto subdir : { "classical/blocks_3", "classical/gripper", "classical/logistics", "classical/miconic", "classical/visitall" })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto lifted_task = compute_lifted_task(absolute(std::string(subdir) + "/domain.pddl"), absolute(std::string(subdir) + "/test-1.pddl"));
+        auto successor_generator = create_successor_generator(lifted_task);
+        auto heuristic = p::GoalCountHeuristic<p::LiftedTag>::create(lifted_task);
+
+        const auto bfws_result = p::bfws::find_solution(*lifted_task, successor_generator, *heuristic);
+        ASSERT_EQ(bfws_result.status, p::SearchStatus::SOLVED);
+        ASSERT_TRUE(bfws_result.plan.has_value());
+        expect_valid_plan(*lifted_task, successor_generator, *bfws_result.plan);
+    }
+
+    // IW(k) is incomplete, but single goal atoms in gripper and logistics have width at most 2.
+    for (const auto subdir : { "classical/gripper", "classical/logistics" })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto lifted_task = compute_lifted_task(absolute(std::string(subdir) + "/domain.pddl"), absolute(std::string(subdir) + "/test-1.pddl"));
+        auto successor_generator = create_successor_generator(lifted_task);
+
+        auto iw_options = p::iw::Options<p::LiftedTag>();
+        iw_options.arity = 2;
+        const auto iw_result = p::iw::find_solution(*lifted_task, successor_generator, iw_options);
+        ASSERT_EQ(iw_result.status, p::SearchStatus::SOLVED);
+        ASSERT_TRUE(iw_result.plan.has_value());
+        expect_valid_plan(*lifted_task, successor_generator, *iw_result.plan);
+    }
+}
+
+TEST(TyrPlanningLiftedTask, NoveltyTableComputesNovelty)
+{
+    auto lifted_task = compute_lifted_task(absolute("classical/gripper/domain.pddl"), absolute("classical/gripper/test-1.pddl"));
+    auto successor_generator = create_successor_generator(lifted_task);
+
+    // s3 moves the robot with the ball picked in s2 to the room of s1: each atom of s3 was seen, but not the pair of the robot position and the carried ball.
+    const auto s0 = successor_generator.get_initial_node();
+    const auto s1 = get_successor(successor_generator, s0, "move");
+    const auto s2 = get_successor(successor_generator, s0, "pick");
+    const auto s3 = get_successor(successor_generator, s2, "move");
+
+    // The atoms of lifted tasks are discovered during search, such that the tables grow.
+    auto width_2 = p::NoveltyTable<p::LiftedTag>(*lifted_task, 2);
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s0.get_state()), uint_t(1));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s0.get_state()), uint_t(3));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s1.get_state()), uint_t(1));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s2.get_state()), uint_t(1));
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s3.get_state()), uint_t(2));
+
+    width_2.clear();
+    EXPECT_EQ(width_2.compute_novelty_and_insert(s3.get_state()), uint_t(1));
+}
 }
@@ -0,0 +1,332 @@
+/*
+ * Copyright (C) 2025-2026 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <tyr/formalism/formalism.hpp>
+#include <tyr/formalism/numeric_bytecode.hpp>
+#include <tyr/planning/applicability.hpp>
+#include <tyr/planning/numeric_bytecode.hpp>
+#include <tyr/planning/planning.hpp>
+
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace p = tyr::planning;
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::tests
+{
+namespace
+{
+
+/**
+ * Expression trees with the interface of the formalism views, such that the compiler accepts them.
+ */
+
+struct Expression;
+
+/// @brief A function term, which loads the value with its index.
+struct Load
+{
+    uint_t index;
+};
+
+template<f::ArithmeticOpKind O>
+struct Unary
+{
+    using OpType = O;
+
+    std::shared_ptr<const Expression> arg;
+
+    const Expression& get_arg() const { return *arg; }
+};
+
+template<f::ArithmeticOpKind O>
+struct Binary
+{
+    using OpType = O;
+
+    std::shared_ptr<const Expression> lhs;
+    std::shared_ptr<const Expression> rhs;
+
+    const Expression& get_lhs() const { return *lhs; }
+    const Expression& get_rhs() const { return *rhs; }
+};
+
+template<f::ArithmeticOpKind O>
+struct Multi
+{
+    using OpType = O;
+
+    std::vector<Expression> args;
+
+    const std::vector<Expression>& get_args() const { return args; }
+};
+
+struct Expression
+{
+    std::variant<float_t,
+                 Load,
+                 Unary<f::OpSub>,
+                 Binary<f::OpAdd>,
+                 Binary<f::OpSub>,
+                 Binary<f::OpMul>,
+                 Binary<f::OpDiv>,
+                 Multi<f::OpAdd>,
+                 Multi<f::OpMul>>
+        value;
+
+    const auto& get_variant() const { return value; }
+};
+
+template<f::BooleanOpKind O>
+struct Comparison
+{
+    using OpType = O;
+
+    Expression lhs;
+    Expression rhs;
+
+    const Expression& get_lhs() const { return lhs; }
+    const Expression& get_rhs() const { return rhs; }
+};
+
+struct Constraint
+{
+    std::variant<Comparison<f::OpEq>, Comparison<f::OpNe>, Comparison<f::OpLe>, Comparison<f::OpLt>, Comparison<f::OpGe>, Comparison<f::OpGt>> value;
+
+    const auto& get_variant() const { return value; }
+};
+
+Expression constant(float_t value) { return Expression { value }; }
+Expression load(uint_t index) { return Expression { Load { index } }; }
+Expression neg(Expression arg) { return Expression { Unary<f::OpSub> { std::make_shared<const Expression>(std::move(arg)) } }; }
+
+template<f::ArithmeticOpKind O>
+Expression binary(Expression lhs, Expression rhs)
+{
+    return Expression { Binary<O> { std::make_shared<const Expression>(std::move(lhs)), std::make_shared<const Expression>(std::move(rhs)) } };
+}
+
+template<f::ArithmeticOpKind O>
+Expression multi(std::vector<Expression> args)
+{
+    return Expression { Multi<O> { std::move(args) } };
+}
+
+/// @brief Evaluate the tree recursively, in the same way as the tree evaluator of the planning formalism.
+float_t evaluate_tree(const Expression& element, const std::vector<float_t>& values)
+{
+    return std::visit(
+        [&](auto&& arg) -> float_t
+        {
+            using T = std::decay_t<decltype(arg)>;
+
+            if constexpr (std::is_same_v<T, float_t>)
+                return arg;
+            else if constexpr (std::is_same_v<T, Load>)
+                return values[arg.index];
+            else if constexpr (requires { arg.get_arg(); })
+                return f::apply(typename T::OpType {}, evaluate_tree(arg.get_arg(), values));
+            else if constexpr (requires { arg.get_lhs(); })
+                return f::apply(typename T::OpType {}, evaluate_tree(arg.get_lhs(), values), evaluate_tree(arg.get_rhs(), values));
+            else
+            {
+                auto result = evaluate_tree(arg.get_args().front(), values);
+                for (size_t i = 1; i < arg.get_args().size(); ++i)
+                    result = f::apply(typename T::OpType {}, result, evaluate_tree(arg.get_args()[i], values));
+                return result;
+            }
+        },
+        element.get_variant());
+}
+
+struct EmitLoad
+{
+    void operator()(f::NumericBytecode& bytecode, const Load& element) const { bytecode.emit_load(f::NumericOpCode::LOAD_FLUENT, element.index); }
+};
+
+struct ValueLoad
+{
+    const std::vector<float_t>& values;
+
+    float_t operator()(const f::NumericInstruction& instruction) const { return values[instruction.arg]; }
+};
+
+/// @brief Compile the expression and expect that the bytecode evaluates to the value of the tree.
+f::NumericExpressionCode expect_same_value(const Expression& element, const std::vector<float_t>& values)
+{
+    auto bytecode = f::NumericBytecode();
+    const auto code = f::compile_expression(element, bytecode, EmitLoad {});
+
+    EXPECT_EQ(f::evaluate<float_t>(bytecode, code, ValueLoad { values }), evaluate_tree(element, values));
+    return code;
+}
+
+p::GroundTaskPtr compute_ground_task(const fs::path& domain_filepath, const fs::path& problem_filepath)
+{
+    auto execution_context = ExecutionContext(1);
+    return p::LiftedTask(fp::Parser(domain_filepath).parse_task(problem_filepath)).instantiate_ground_task(execution_context).task;
+}
+
+fs::path absolute(const std::string& subdir) { return fs::path(std::string(ROOT_DIR)) / "data" / "tests" / subdir; }
+}
+
+TEST(TyrPlanningNumericBytecode, BinaryOperatorsMatchTree)
+{
+    const auto values = std::vector<float_t> { 3, -2, 0.5 };
+
+    expect_same_value(binary<f::OpAdd>(load(0), load(1)), values);
+    expect_same_value(binary<f::OpSub>(load(0), load(1)), values);
+    expect_same_value(binary<f::OpMul>(load(0), constant(4)), values);
+    expect_same_value(binary<f::OpDiv>(load(1), load(2)), values);
+
+    // The operands of non-commutative operators keep their order.
+    EXPECT_EQ(evaluate_tree(binary<f::OpSub>(load(0), load(1)), values), float_t(5));
+    EXPECT_EQ(evaluate_tree(binary<f::OpDiv>(load(1), load(2)), values), float_t(-4));
+}
+
+TEST(TyrPlanningNumericBytecode, MultiOperatorsMatchTree)
+{
+    const auto values = std::vector<float_t> { 1, 2, 3, 4 };
+
+    // Regression: the arguments of a multi operator must be combined with its own operator, i.e., 1 + 2 + 3 + 4 instead of 1 * 2 * 3 * 4.
+    const auto sum = multi<f::OpAdd>({ load(0), load(1), load(2), load(3) });
+    auto bytecode = f::NumericBytecode();
+    const auto code = f::compile_expression(sum, bytecode, EmitLoad {});
+    EXPECT_EQ(f::evaluate<float_t>(bytecode, code, ValueLoad { values }), float_t(10));
+    EXPECT_EQ(evaluate_tree(sum, values), float_t(10));
+
+    // The arguments are accumulated from left to right, such that two values are on the stack at any time.
+    EXPECT_EQ(code.max_stack_size, uint_t(2));
+    EXPECT_EQ(code.end - code.begin, uint_t(7));
+
+    expect_same_value(multi<f::OpMul>({ load(1), load(2), load(3) }), values);
+    expect_same_value(multi<f::OpAdd>({ load(0), constant(0.25) }), values);
+    expect_same_value(multi<f::OpMul>({ load(3) }), values);
+}
+
+TEST(TyrPlanningNumericBytecode, UnaryMinusMatchesTree)
+{
+    const auto values = std::vector<float_t> { 3, -2 };
+
+    expect_same_value(neg(load(0)), values);
+    expect_same_value(neg(neg(load(1))), values);
+    expect_same_value(binary<f::OpSub>(neg(load(0)), load(1)), values);
+    expect_same_value(multi<f::OpAdd>({ neg(load(0)), load(1), neg(constant(1)) }), values);
+}
+
+TEST(TyrPlanningNumericBytecode, NestedExpressionsMatchTree)
+{
+    const auto values = std::vector<float_t> { 3, -2, 8, 0.5 };
+
+    // (x0 + 2) * -(x1 - x2 / 4) + x3 * x0 * x1
+    const auto element = multi<f::OpAdd>({ binary<f::OpMul>(binary<f::OpAdd>(load(0), constant(2)), neg(binary<f::OpSub>(load(1), binary<f::OpDiv>(load(2), constant(4))))),
+                                           multi<f::OpMul>({ load(3), load(0), load(1) }) });
+    expect_same_value(element, values);
+    EXPECT_EQ(evaluate_tree(element, values), float_t(17));
+
+    // Constraints compare the values of both sides.
+    const auto compare = [&](Constraint constraint, bool expected)
+    {
+        auto bytecode = f::NumericBytecode();
+        const auto code = f::compile_constraint(constraint, bytecode, EmitLoad {});
+        EXPECT_EQ(f::evaluate(bytecode, code, ValueLoad { values }), expected);
+    };
+    compare(Constraint { Comparison<f::OpGt> { element, load(2) } }, true);
+    compare(Constraint { Comparison<f::OpLe> { element, load(2) } }, false);
+    compare(Constraint { Comparison<f::OpEq> { neg(load(1)), constant(2) } }, true);
+    compare(Constraint { Comparison<f::OpNe> { neg(load(1)), constant(2) } }, false);
+}
+
+TEST(TyrPlanningNumericBytecode, DeepExpressionsUseHeapStack)
+{
+    // x0 + (x1 + (x2 + ...)) keeps every argument on the stack until the innermost addition, unlike the left-nested sum.
+    constexpr uint_t depth = 40;
+
+    auto values = std::vector<float_t> {};
+    for (uint_t i = 0; i <= depth; ++i)
+        values.push_back(float_t(i));
+
+    auto right_nested = load(depth);
+    auto left_nested = load(0);
+    for (uint_t i = 1; i <= depth; ++i)
+    {
+        right_nested = binary<f::OpAdd>(load(depth - i), std::move(right_nested));
+        left_nested = binary<f::OpAdd>(std::move(left_nested), load(i));
+    }
+
+    // The right-nested sum exceeds the inline stack of 32 values.
+    const auto right_code = expect_same_value(right_nested, values);
+    EXPECT_EQ(right_code.max_stack_size, depth + 1);
+    EXPECT_EQ(evaluate_tree(right_nested, values), float_t(depth * (depth + 1) / 2));
+
+    const auto left_code = expect_same_value(left_nested, values);
+    EXPECT_EQ(left_code.max_stack_size, uint_t(2));
+}
+
+TEST(TyrPlanningNumericBytecode, GroundTasksMatchTreeEvaluator)
+{
+    for (const auto subdir : { "numeric/fo-counters", "numeric/refuel", "numeric/refuel-adl", "numeric/tpp", "numeric/zenotravel" })
+    {
+        SCOPED_TRACE(subdir);
+
+        auto ground_task = compute_ground_task(absolute(std::string(subdir) + "/domain.pddl"), absolute(std::string(subdir) + "/test-1.pddl"));
+        auto successor_generator = p::SuccessorGenerator<p::GroundTag>(ground_task, ExecutionContext::create(1));
+
+        auto bytecode = f::NumericBytecode();
+        auto constraints = std::vector<std::pair<fp::GroundBooleanOperatorView, f::NumericConstraintCode>> {};
+        auto effects = std::vector<std::pair<fp::GroundNumericEffectOperatorView<f::FluentTag>, f::NumericExpressionCode>> {};
+
+        for (const auto constraint : ground_task->get_task().get_goal().get_numeric_constraints())
+            constraints.emplace_back(constraint, p::compile(constraint, bytecode));
+
+        for (const auto action : ground_task->get_task().get_ground_actions())
+        {
+            for (const auto constraint : action.get_condition().get_numeric_constraints())
+                constraints.emplace_back(constraint, p::compile(constraint, bytecode));
+
+            for (const auto cond_effect : action.get_effects())
+            {
+                for (const auto constraint : cond_effect.get_condition().get_numeric_constraints())
+                    constraints.emplace_back(constraint, p::compile(constraint, bytecode));
+                for (const auto numeric_effect : cond_effect.get_effect().get_numeric_effects())
+                    effects.emplace_back(numeric_effect, p::compile(numeric_effect, bytecode));
+            }
+        }
+        ASSERT_FALSE(constraints.empty() && effects.empty());
+
+        auto nodes = std::vector<p::Node<p::GroundTag>> { successor_generator.get_initial_node() };
+        for (size_t i = 0; i < nodes.size() && i < 20; ++i)
+        {
+            const auto state = nodes[i].get_state();
+            const auto context = p::StateContext<p::GroundTag> { *ground_task, state.get_unpacked_state(), float_t { 0 } };
+
+            for (const auto& [constraint, code] : constraints)
+                EXPECT_EQ(p::is_applicable(bytecode, code, context), p::evaluate(constraint, context));
+            for (const auto& [numeric_effect, code] : effects)
+                EXPECT_EQ(p::evaluate(bytecode, code, context), p::evaluate(numeric_effect, context));
+
+            for (const auto& successor : successor_generator.get_labeled_successor_nodes(nodes[i]))
+                nodes.push_back(successor.node);
+        }
+    }
+}
+}